@@ -0,0 +1,56 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Arrays returned to native code are pinned per call and unpinned by the Coral::ArrayView that received them
+internal static class ArrayPins
+{
+	// Matches Coral::ArrayView
+	[StructLayout(LayoutKind.Sequential)]
+	private struct ArrayViewData
+	{
+		public IntPtr Data;
+		public IntPtr PinHandle;
+		public int Length;
+	}
+
+	internal static unsafe void WriteView(Array? InArray, IntPtr OutView)
+	{
+		var view = (ArrayViewData*)OutView;
+		*view = default;
+
+		if (InArray == null)
+			return;
+
+		var elementType = InArray.GetType().GetElementType()!;
+
+		// Pinning is only allowed for arrays without references, anything else would need a copy
+		if (!MarshalEmitter.IsBlittable(elementType))
+		{
+			LogMessage($"Cannot return an array of '{elementType.FullName}' to native code. Only arrays of blittable types can be pinned.", MessageLevel.Error);
+			return;
+		}
+
+		var handle = GCHandle.Alloc(InArray, GCHandleType.Pinned);
+
+		view->Data = handle.AddrOfPinnedObject();
+		view->PinHandle = GCHandle.ToIntPtr(handle);
+		view->Length = InArray.Length;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void ReleaseArrayPin(IntPtr InPinHandle)
+	{
+		try
+		{
+			GCHandle.FromIntPtr(InPinHandle).Free();
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+}
@@ -0,0 +1,251 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+internal delegate void FieldCopier(object InTarget, IntPtr InBuffer);
+
+internal sealed class FieldSet
+{
+	public readonly Type DeclaringType;
+	public readonly FieldInfo[] Fields;
+	public readonly int[] Offsets;
+
+	// Null if the copy couldn't be compiled, the fields are then copied one by one through reflection
+	public FieldCopier? Read;
+	public FieldCopier? Write;
+
+	public FieldSet(Type InDeclaringType, FieldInfo[] InFields, int[] InOffsets)
+	{
+		DeclaringType = InDeclaringType;
+		Fields = InFields;
+		Offsets = InOffsets;
+	}
+}
+
+// A fixed list of instance fields mapped to offsets in a native struct, lets native code read or write all of them in a single call.
+// The copy plan is validated once when the set is created and compiled into one method per direction.
+internal static class FieldSets
+{
+	internal static readonly UniqueIdList<FieldSet> s_FieldSets = new();
+
+	private static readonly Type[] s_CopierParameterTypes = [typeof(object), typeof(IntPtr)];
+
+	// Size of the value in the native buffer, matching what GetFieldValue / SetFieldValue write and read
+	private static int GetNativeSize(Type InType)
+	{
+		if (InType.IsPointer || InType == typeof(IntPtr))
+			return IntPtr.Size;
+
+		if (InType == typeof(bool))
+			return Marshal.SizeOf<Bool32>();
+
+		if (InType == typeof(string))
+			return Marshal.SizeOf<NativeString>();
+
+		return Marshal.SizeOf(InType.IsEnum ? Enum.GetUnderlyingType(InType) : InType);
+	}
+
+	private static FieldCopier Compile(FieldSet InFieldSet, bool InIsWrite)
+	{
+		var method = new DynamicMethod($"{(InIsWrite ? "Write" : "Read")}Fields_{InFieldSet.DeclaringType.Name}", typeof(void), s_CopierParameterTypes, restrictedSkipVisibility: true);
+		var il = method.GetILGenerator();
+
+		var target = il.DeclareLocal(InFieldSet.DeclaringType.IsValueType ? InFieldSet.DeclaringType.MakeByRefType() : InFieldSet.DeclaringType);
+		il.Emit(OpCodes.Ldarg_0);
+		il.Emit(InFieldSet.DeclaringType.IsValueType ? OpCodes.Unbox : OpCodes.Castclass, InFieldSet.DeclaringType);
+		il.Emit(OpCodes.Stloc, target);
+
+		for (int i = 0; i < InFieldSet.Fields.Length; i++)
+		{
+			var field = InFieldSet.Fields[i];
+
+			if (InIsWrite)
+			{
+				il.Emit(OpCodes.Ldloc, target);
+				il.Emit(OpCodes.Ldarg_1);
+				il.Emit(OpCodes.Ldc_I4, InFieldSet.Offsets[i]);
+				il.Emit(OpCodes.Add);
+
+				// The buffer holds the pointer itself, unlike a single field value where the address is the value
+				if (field.FieldType.IsPointer || field.FieldType == typeof(IntPtr))
+					il.Emit(OpCodes.Ldind_I);
+				else
+					MarshalEmitter.EmitReadField(il, field.FieldType);
+
+				il.Emit(OpCodes.Stfld, field);
+			}
+			else
+			{
+				il.Emit(OpCodes.Ldarg_1);
+				il.Emit(OpCodes.Ldc_I4, InFieldSet.Offsets[i]);
+				il.Emit(OpCodes.Add);
+				il.Emit(OpCodes.Ldloc, target);
+				il.Emit(OpCodes.Ldfld, field);
+				MarshalEmitter.EmitStore(il, field.FieldType);
+			}
+		}
+
+		il.Emit(OpCodes.Ret);
+
+		return method.CreateDelegate<FieldCopier>();
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe int CreateFieldSet(int InType, int* InFieldHandles, int* InOffsets, int InFieldCount, int InBufferSize)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage("Cannot create a field set for a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			var fields = new FieldInfo[InFieldCount];
+			var offsets = new int[InFieldCount];
+
+			for (int i = 0; i < InFieldCount; i++)
+			{
+				if (!TypeInterface.s_CachedFields.TryGetValue(InFieldHandles[i], out var fieldInfo) || fieldInfo == null)
+				{
+					LogMessage($"Failed to create field set for type '{type.FullName}'. Field {i} has an invalid handle.", MessageLevel.Error);
+					return -1;
+				}
+
+				if (fieldInfo.IsStatic || fieldInfo.DeclaringType == null || !fieldInfo.DeclaringType.IsAssignableFrom(type))
+				{
+					LogMessage($"Failed to create field set for type '{type.FullName}'. Field '{fieldInfo.Name}' isn't an instance field of the type.", MessageLevel.Error);
+					return -1;
+				}
+
+				if (!MarshalEmitter.CanEmitReturn(fieldInfo.FieldType))
+				{
+					LogMessage($"Failed to create field set for type '{type.FullName}'. Field '{fieldInfo.Name}' of type '{fieldInfo.FieldType.FullName}' can't be copied to native memory.", MessageLevel.Error);
+					return -1;
+				}
+
+				if (InOffsets[i] < 0 || InOffsets[i] + GetNativeSize(fieldInfo.FieldType) > InBufferSize)
+				{
+					LogMessage($"Failed to create field set for type '{type.FullName}'. Field '{fieldInfo.Name}' at offset {InOffsets[i]} doesn't fit in a buffer of {InBufferSize} bytes.", MessageLevel.Error);
+					return -1;
+				}
+
+				fields[i] = fieldInfo;
+				offsets[i] = InOffsets[i];
+			}
+
+			var fieldSet = new FieldSet(type, fields, offsets);
+
+			if (MethodInvokers.IsEnabled)
+			{
+				try
+				{
+					fieldSet.Read = Compile(fieldSet, false);
+					fieldSet.Write = Compile(fieldSet, true);
+				}
+				catch (Exception ex)
+				{
+					LogMessage($"Failed to compile field set for type '{type.FullName}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+					fieldSet.Read = null;
+					fieldSet.Write = null;
+				}
+			}
+
+			return s_FieldSets.Add(fieldSet);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	private static object? GetTarget(IntPtr InTarget, int InFieldSet, out FieldSet? OutFieldSet)
+	{
+		OutFieldSet = null;
+
+		var target = GCHandle.FromIntPtr(InTarget).Target;
+
+		if (target == null)
+		{
+			LogMessage($"Cannot copy field set {InFieldSet} for object with handle {InTarget}. Target was null.", MessageLevel.Error);
+			return null;
+		}
+
+		if (!s_FieldSets.TryGetValue(InFieldSet, out OutFieldSet) || OutFieldSet == null)
+		{
+			LogMessage($"Failed to find field set with handle '{InFieldSet}'.", MessageLevel.Error);
+			return null;
+		}
+
+		if (!OutFieldSet.DeclaringType.IsInstanceOfType(target))
+		{
+			LogMessage($"Cannot copy field set created for type '{OutFieldSet.DeclaringType.FullName}' for an object of type '{target.GetType().FullName}'.", MessageLevel.Error);
+			return null;
+		}
+
+		return target;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void ReadFields(IntPtr InTarget, int InFieldSet, IntPtr OutBuffer)
+	{
+		try
+		{
+			var target = GetTarget(InTarget, InFieldSet, out var fieldSet);
+
+			if (target == null || fieldSet == null)
+				return;
+
+			if (fieldSet.Read != null)
+			{
+				fieldSet.Read(target, OutBuffer);
+				return;
+			}
+
+			for (int i = 0; i < fieldSet.Fields.Length; i++)
+				ManagedObject.GetFieldValueInternal(target, fieldSet.Fields[i], OutBuffer + fieldSet.Offsets[i]);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void WriteFields(IntPtr InTarget, int InFieldSet, IntPtr InBuffer)
+	{
+		try
+		{
+			var target = GetTarget(InTarget, InFieldSet, out var fieldSet);
+
+			if (target == null || fieldSet == null)
+				return;
+
+			if (fieldSet.Write != null)
+			{
+				fieldSet.Write(target, InBuffer);
+				return;
+			}
+
+			for (int i = 0; i < fieldSet.Fields.Length; i++)
+				ManagedObject.SetFieldValueInternal(target, fieldSet.Fields[i], InBuffer + fieldSet.Offsets[i]);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	internal static void Clear()
+	{
+		s_FieldSets.Clear();
+	}
+}
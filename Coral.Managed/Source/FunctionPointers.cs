@@ -0,0 +1,162 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Hands out native callable pointers to static methods. Methods marked with [UnmanagedCallersOnly] are returned
+// directly, anything else gets a reverse P/Invoke thunk through a delegate type that's emitted for its signature.
+internal static class FunctionPointers
+{
+	// Keeps the thunk delegates alive for as long as native code may call them
+	private static readonly ConcurrentDictionary<MethodInfo, Delegate> s_Thunks = new();
+
+	private static readonly ConstructorInfo s_MarshalAsConstructor = typeof(MarshalAsAttribute).GetConstructor([typeof(UnmanagedType)])!;
+	private static readonly ConstructorInfo s_UnmanagedFunctionPointerConstructor = typeof(UnmanagedFunctionPointerAttribute).GetConstructor([typeof(CallingConvention)])!;
+
+	private static bool IsCompatible(Type InManagedType, ManagedType InNativeType, int InNativeSize, bool InIsUnmanagedCallersOnly)
+	{
+		if (InManagedType.IsPointer || InManagedType == typeof(IntPtr) || InManagedType == typeof(UIntPtr))
+			return InNativeType == ManagedType.Pointer;
+
+		// bool is only valid for thunks, where it's marshalled as a single byte to match the native bool
+		if (InManagedType == typeof(bool))
+			return !InIsUnmanagedCallersOnly && InNativeType == ManagedType.Bool && InNativeSize == 1;
+
+		if (InManagedType == typeof(Bool32))
+			return InNativeType == ManagedType.UInt && InNativeSize == 4;
+
+		if (!MarshalEmitter.IsBlittable(InManagedType))
+			return false;
+
+		var underlyingType = InManagedType.IsEnum ? Enum.GetUnderlyingType(InManagedType) : InManagedType;
+
+		if (Marshal.SizeOf(underlyingType) != InNativeSize)
+			return false;
+
+		// Native structs can only be checked by size
+		if (InNativeType == ManagedType.Unknown)
+			return true;
+
+		return TypeInterface.GetManagedType(underlyingType) == InNativeType;
+	}
+
+	private static unsafe bool IsSignatureCompatible(MethodInfo InMethodInfo, ManagedType InReturnType, int InReturnSize, ManagedType* InParameterTypes, int* InParameterSizes, int InParameterCount)
+	{
+		var parameters = InMethodInfo.GetParameters();
+
+		if (parameters.Length != InParameterCount)
+			return false;
+
+		bool isUnmanagedCallersOnly = InMethodInfo.IsDefined(typeof(UnmanagedCallersOnlyAttribute));
+
+		if (InMethodInfo.ReturnType == typeof(void))
+		{
+			if (InReturnSize != 0)
+				return false;
+		}
+		else if (!IsCompatible(InMethodInfo.ReturnType, InReturnType, InReturnSize, isUnmanagedCallersOnly))
+		{
+			return false;
+		}
+
+		for (int i = 0; i < parameters.Length; i++)
+		{
+			if (!IsCompatible(parameters[i].ParameterType, InParameterTypes[i], InParameterSizes[i], isUnmanagedCallersOnly))
+				return false;
+		}
+
+		return true;
+	}
+
+	private static Type CreateDelegateType(MethodInfo InMethodInfo)
+	{
+		// Each thunk gets its own collectible assembly so it never keeps another AssemblyLoadContext alive
+		var assemblyBuilder = AssemblyBuilder.DefineDynamicAssembly(new AssemblyName($"Coral.Thunk.{InMethodInfo.DeclaringType!.Name}.{InMethodInfo.Name}"), AssemblyBuilderAccess.RunAndCollect);
+		var moduleBuilder = assemblyBuilder.DefineDynamicModule("Thunk");
+		var typeBuilder = moduleBuilder.DefineType($"{InMethodInfo.Name}Thunk", TypeAttributes.Public | TypeAttributes.Sealed | TypeAttributes.AutoClass, typeof(MulticastDelegate));
+		typeBuilder.SetCustomAttribute(new CustomAttributeBuilder(s_UnmanagedFunctionPointerConstructor, [CallingConvention.Cdecl]));
+
+		var constructorBuilder = typeBuilder.DefineConstructor(MethodAttributes.RTSpecialName | MethodAttributes.SpecialName | MethodAttributes.HideBySig | MethodAttributes.Public, CallingConventions.Standard, [typeof(object), typeof(IntPtr)]);
+		constructorBuilder.SetImplementationFlags(MethodImplAttributes.Runtime | MethodImplAttributes.Managed);
+
+		var parameters = InMethodInfo.GetParameters();
+		var parameterTypes = new Type[parameters.Length];
+
+		for (int i = 0; i < parameters.Length; i++)
+			parameterTypes[i] = parameters[i].ParameterType;
+
+		var invokeBuilder = typeBuilder.DefineMethod("Invoke", MethodAttributes.Public | MethodAttributes.HideBySig | MethodAttributes.NewSlot | MethodAttributes.Virtual, InMethodInfo.ReturnType, parameterTypes);
+		invokeBuilder.SetImplementationFlags(MethodImplAttributes.Runtime | MethodImplAttributes.Managed);
+
+		// Parameter 0 is the return value
+		for (int i = 0; i <= parameters.Length; i++)
+		{
+			var type = i == 0 ? InMethodInfo.ReturnType : parameterTypes[i - 1];
+
+			if (type != typeof(bool))
+				continue;
+
+			var parameterBuilder = invokeBuilder.DefineParameter(i, ParameterAttributes.HasFieldMarshal, null);
+			parameterBuilder.SetCustomAttribute(new CustomAttributeBuilder(s_MarshalAsConstructor, [UnmanagedType.U1]));
+		}
+
+		return typeBuilder.CreateType();
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe IntPtr GetFunctionPointer(int InType, NativeString InMethodName, ManagedType InReturnType, int InReturnSize, ManagedType* InParameterTypes, int* InParameterSizes, int InParameterCount)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot get function pointer for method {InMethodName} on a null type.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			string? methodName = InMethodName;
+			MethodInfo? methodInfo = null;
+
+			foreach (var method in type.GetMethods(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static))
+			{
+				if (method.Name != methodName || method.ContainsGenericParameters)
+					continue;
+
+				if (!IsSignatureCompatible(method, InReturnType, InReturnSize, InParameterTypes, InParameterSizes, InParameterCount))
+					continue;
+
+				methodInfo = method;
+				break;
+			}
+
+			if (methodInfo == null)
+			{
+				LogMessage($"Failed to find static method '{methodName}' in type {type.FullName} matching the requested native signature with {InParameterCount} parameters.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			if (methodInfo.IsDefined(typeof(UnmanagedCallersOnlyAttribute)))
+				return methodInfo.MethodHandle.GetFunctionPointer();
+
+			var thunk = s_Thunks.GetOrAdd(methodInfo, static method => Delegate.CreateDelegate(CreateDelegateType(method), method));
+			return Marshal.GetFunctionPointerForDelegate(thunk);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	internal static void Clear()
+	{
+		s_Thunks.Clear();
+	}
+}
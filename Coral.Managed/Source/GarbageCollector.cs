@@ -37,4 +37,10 @@ internal static class GarbageCollector
 		}
 	}
 
+	[UnmanagedCallersOnly]
+	internal static long GetAllocatedBytesForCurrentThread()
+	{
+		return GC.GetAllocatedBytesForCurrentThread();
+	}
+
 }
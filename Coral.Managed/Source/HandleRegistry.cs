@@ -0,0 +1,140 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Reflection;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using System.Threading;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Tracks the GCHandles given to native code so that UnloadAssemblyLoadContext can report and free the ones that were never destroyed.
+// Handles are grouped per AssemblyLoadContext in concurrent tables keyed by the handle itself, registering or removing one is a
+// single lookup that doesn't block other threads, which keeps tracking cheap enough to enable in release builds as a leak check.
+internal static class HandleRegistry
+{
+	private sealed class HandleTable
+	{
+		public readonly ConcurrentDictionary<IntPtr, (GCHandle Handle, Type Type)> Handles = new();
+	}
+
+#if DEBUG
+	private static bool s_Enabled = true;
+#else
+	private static bool s_Enabled = false;
+#endif
+
+	private static readonly ConcurrentDictionary<AssemblyLoadContext, HandleTable> s_Tables = new();
+	private static readonly ConcurrentDictionary<Assembly, HandleTable> s_AssemblyTables = new();
+
+	// Handles registered while tracking was enabled have to be removed even after it's disabled, otherwise Release would free them again
+	private static int s_HandleCount = 0;
+
+	internal static bool IsEnabled => s_Enabled;
+
+	private static HandleTable GetTable(Assembly InAssembly)
+	{
+		return s_AssemblyTables.GetOrAdd(InAssembly, static assembly =>
+		{
+			var alc = AssemblyLoadContext.GetLoadContext(assembly) ?? AssemblyLoadContext.Default;
+			return s_Tables.GetOrAdd(alc, static _ => new HandleTable());
+		});
+	}
+
+	internal static void Register(GCHandle InHandle, Type InType)
+	{
+		if (!s_Enabled)
+			return;
+
+		if (GetTable(InType.Assembly).Handles.TryAdd(GCHandle.ToIntPtr(InHandle), (InHandle, InType)))
+			Interlocked.Increment(ref s_HandleCount);
+	}
+
+	// Has to be called before the handle is freed
+	internal static void Deregister(GCHandle InHandle)
+	{
+		if (Volatile.Read(ref s_HandleCount) == 0)
+			return;
+
+		if (!InHandle.IsAllocated)
+		{
+			LogMessage("HandleRegistry de-registering an already freed handle.", MessageLevel.Error);
+			return;
+		}
+
+		var handlePtr = GCHandle.ToIntPtr(InHandle);
+		var target = InHandle.Target;
+
+		if (target != null && Remove(GetTable(target.GetType().Assembly), handlePtr))
+			return;
+
+		// Weak handles whose target was collected, we don't know which context they belong to anymore
+		foreach (var table in s_Tables.Values)
+		{
+			if (Remove(table, handlePtr))
+				return;
+		}
+	}
+
+	private static bool Remove(HandleTable InTable, IntPtr InHandle)
+	{
+		if (!InTable.Handles.TryRemove(InHandle, out _))
+			return false;
+
+		Interlocked.Decrement(ref s_HandleCount);
+		return true;
+	}
+
+	// Frees every handle that's still registered for the context and logs how many were left per type
+	internal static void Release(AssemblyLoadContext InContext)
+	{
+		foreach (var assembly in s_AssemblyTables.Keys)
+		{
+			if (AssemblyLoadContext.GetLoadContext(assembly) == InContext)
+				s_AssemblyTables.TryRemove(assembly, out _);
+		}
+
+		if (!s_Tables.TryRemove(InContext, out var table))
+			return;
+
+		var handles = new List<(GCHandle Handle, Type Type)>();
+
+		foreach (var handlePtr in table.Handles.Keys)
+		{
+			if (table.Handles.TryRemove(handlePtr, out var entry))
+			{
+				Interlocked.Decrement(ref s_HandleCount);
+				handles.Add(entry);
+			}
+		}
+
+		if (handles.Count == 0)
+			return;
+
+		var liveCounts = new Dictionary<Type, int>();
+
+		foreach (var (handle, type) in handles)
+		{
+			liveCounts.TryGetValue(type, out int count);
+			liveCounts[type] = count + 1;
+
+			if (handle.IsAllocated)
+				handle.Free();
+		}
+
+		LogMessage($"Found {handles.Count} handles that were never destroyed in AssemblyLoadContext '{InContext.Name}'. Deallocating.", MessageLevel.Warning);
+
+		foreach (var (type, count) in liveCounts)
+			LogMessage($"    {count} live handles of type '{type.FullName}'", MessageLevel.Warning);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetHandleTrackingEnabled(Bool32 InEnabled)
+	{
+		s_Enabled = InEnabled;
+	}
+}
@@ -0,0 +1,156 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using System.Threading;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// When enabled every strong handle given to native code for the same object is the same handle. The handle is reference counted
+// and only freed once native code has destroyed it as many times as it was handed out, so native code can compare objects by handle.
+internal static class IdentityMap
+{
+	private sealed class Entry
+	{
+		public IntPtr Handle;
+		public int RefCount;
+	}
+
+	private static bool s_Enabled = false;
+
+	// Keyed by reference, user types overriding Equals or GetHashCode don't affect the lookup
+	private static readonly ConditionalWeakTable<object, Entry> s_Entries = new();
+	private static readonly object s_Lock = new();
+
+	// Entries stay until their handle is released, so the map is still checked after being disabled
+	private static int s_EntryCount = 0;
+
+	internal static bool IsEnabled => s_Enabled;
+
+	internal static IntPtr Acquire(object InObject)
+	{
+		lock (s_Lock)
+		{
+			if (s_Entries.TryGetValue(InObject, out var entry))
+			{
+				entry.RefCount++;
+				return entry.Handle;
+			}
+
+			var handle = GCHandle.Alloc(InObject, GCHandleType.Normal);
+			HandleRegistry.Register(handle, InObject.GetType());
+
+			entry = new Entry { Handle = GCHandle.ToIntPtr(handle), RefCount = 1 };
+			s_Entries.Add(InObject, entry);
+			s_EntryCount++;
+
+			return entry.Handle;
+		}
+	}
+
+	// Shares a handle that was created elsewhere (e.g by an object pool), returns the handle that's already shared if there is one
+	internal static IntPtr Adopt(object InObject, IntPtr InHandle)
+	{
+		lock (s_Lock)
+		{
+			if (s_Entries.TryGetValue(InObject, out var entry))
+			{
+				entry.RefCount++;
+				return entry.Handle;
+			}
+
+			s_Entries.Add(InObject, new Entry { Handle = InHandle, RefCount = 1 });
+			s_EntryCount++;
+			return InHandle;
+		}
+	}
+
+	internal static bool Contains(object InObject)
+	{
+		if (Volatile.Read(ref s_EntryCount) == 0)
+			return false;
+
+		lock (s_Lock)
+			return s_Entries.TryGetValue(InObject, out _);
+	}
+
+	// Returns false if the handle isn't owned by the map and has to be freed by the caller
+	internal static bool Release(GCHandle InHandle)
+	{
+		if (Volatile.Read(ref s_EntryCount) == 0)
+			return false;
+
+		var target = InHandle.Target;
+
+		if (target == null)
+			return false;
+
+		lock (s_Lock)
+		{
+			if (!s_Entries.TryGetValue(target, out var entry) || entry.Handle != GCHandle.ToIntPtr(InHandle))
+				return false;
+
+			if (--entry.RefCount > 0)
+				return true;
+
+			s_Entries.Remove(target);
+			s_EntryCount--;
+		}
+
+		// Pooled objects keep their handle, it's shared again once the object is rented
+		if (ObjectPools.Return(InHandle))
+			return true;
+
+		HandleRegistry.Deregister(InHandle);
+		InHandle.Free();
+		return true;
+	}
+
+	// Frees the shared handles to objects from the context regardless of how many times they were handed out
+	internal static void Release(AssemblyLoadContext InContext)
+	{
+		var handles = new List<GCHandle>();
+
+		lock (s_Lock)
+		{
+			if (s_EntryCount == 0)
+				return;
+
+			var keys = new List<object>();
+
+			foreach (var (target, entry) in s_Entries)
+			{
+				if (AssemblyLoadContext.GetLoadContext(target.GetType().Assembly) != InContext)
+					continue;
+
+				keys.Add(target);
+				handles.Add(GCHandle.FromIntPtr(entry.Handle));
+			}
+
+			foreach (var key in keys)
+				s_Entries.Remove(key);
+
+			s_EntryCount -= keys.Count;
+		}
+
+		foreach (var handle in handles)
+		{
+			HandleRegistry.Deregister(handle);
+			handle.Free();
+		}
+
+		if (handles.Count > 0)
+			LogMessage($"Released {handles.Count} shared object handles that were still in use in AssemblyLoadContext '{InContext.Name}'.", MessageLevel.Warning);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetObjectIdentityEnabled(Bool32 InEnabled)
+	{
+		s_Enabled = InEnabled;
+	}
+}
@@ -4,6 +4,7 @@ using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
 using System.Reflection;
 using System.Runtime.InteropServices;
+using System.Text;
 
 namespace Coral.Managed.Interop;
 
@@ -134,39 +135,6 @@ public struct NativeArray<T> : IDisposable, IEnumerable<T>
 
 }
 
-public static class ArrayStorage
-{
-	private static Dictionary<int, GCHandle> s_FieldArrays = new();
-
-	public static bool HasFieldArray(object? InTarget, MemberInfo? InArrayMemberInfo)
-	{
-		if (InArrayMemberInfo == null)
-			return false;
-
-		int arrayId = InArrayMemberInfo.GetHashCode();
-		arrayId += InTarget != null ? InTarget.GetHashCode() : 0;
-		return s_FieldArrays.ContainsKey(arrayId);
-	}
-
-	public static GCHandle? GetFieldArray(object? InTarget, object? InValue, MemberInfo? InArrayMemberInfo)
-	{
-		if (InArrayMemberInfo == null)
-			return null;
-
-		int arrayId = InArrayMemberInfo.GetHashCode();
-		arrayId += InTarget != null ? InTarget.GetHashCode() : 0;
-
-		if (!s_FieldArrays.TryGetValue(arrayId, out var arrayHandle))
-		{
-			var arrayObject = InValue as Array;
-			arrayHandle = GCHandle.Alloc(arrayObject, GCHandleType.Pinned);
-			s_FieldArrays.Add(arrayId, arrayHandle);
-		}
-
-		return arrayHandle;
-	}
-}
-
 [StructLayout(LayoutKind.Sequential, Size=16, Pack=8)]
 public struct NativeInstance<T> : IDisposable
 {
@@ -183,15 +151,7 @@ public struct NativeInstance<T> : IDisposable
 	{
 		if (m_Handle != IntPtr.Zero)
 		{
-			var handle = GCHandle.FromIntPtr(m_Handle);
-#if DEBUG
-			var type = handle.Target?.GetType();
-			if (type is not null)
-			{
-				AssemblyLoader.DeregisterHandle(type.Assembly, handle);
-			}
-#endif
-			handle.Free();
+			ManagedObject.FreeHandle(m_Handle);
 			m_Handle = IntPtr.Zero;
 		}
 		GC.SuppressFinalize(this);
@@ -210,9 +170,22 @@ public struct NativeInstance<T> : IDisposable
 		return (T)handle.Target;
 	}
 
+	// The pointer native code attached with ManagedObject::SetUserData
+	public IntPtr GetUserData()
+	{
+		if (m_Handle == IntPtr.Zero)
+			return IntPtr.Zero;
+
+		var target = GCHandle.FromIntPtr(m_Handle).Target;
+		return target != null ? UserData.Get(target) : IntPtr.Zero;
+	}
+
 	public static implicit operator NativeInstance<T>(T instance)
 	{
-		return new(GCHandle.ToIntPtr(GCHandle.Alloc(instance, GCHandleType.Normal)));
+		if (instance == null)
+			return new(GCHandle.ToIntPtr(GCHandle.Alloc(instance, GCHandleType.Normal)));
+
+		return new(ManagedObject.AllocateHandle(instance, false));
 	}
 
 	public static implicit operator T?(NativeInstance<T> InInstance)
@@ -254,6 +227,53 @@ public struct NativeString : IDisposable
 	public static implicit operator string?(NativeString InString) => Marshal.PtrToStringAuto(InString.m_NativeString);
 }
 
+// Matches Coral::Utf8StringView. Points to UTF-8 characters owned by native code, which are only valid during the call they were passed to.
+// Nothing is copied or decoded until ToString is called, AsSpan gives direct access to the bytes.
+[StructLayout(LayoutKind.Sequential)]
+public readonly struct NativeStringView
+{
+	private readonly IntPtr m_Data;
+	private readonly long m_Length;
+
+	public int Length => (int)m_Length;
+	public bool IsEmpty => m_Length == 0;
+
+	public unsafe ReadOnlySpan<byte> AsSpan() => new(m_Data.ToPointer(), (int)m_Length);
+
+	public bool Equals(ReadOnlySpan<byte> InUtf8) => AsSpan().SequenceEqual(InUtf8);
+
+	public override string ToString() => m_Length > 0 ? Encoding.UTF8.GetString(AsSpan()) : string.Empty;
+
+	public static implicit operator ReadOnlySpan<byte>(NativeStringView InView) => InView.AsSpan();
+	public static implicit operator string(NativeStringView InView) => InView.ToString();
+}
+
+// Matches Coral::MemberName. Names are decoded once and then looked up by their hash, so passing the same name again doesn't allocate.
+// At most 4096 names are kept, the cache is emptied whenever an assembly load context is unloaded.
+[StructLayout(LayoutKind.Sequential)]
+public readonly struct MemberName
+{
+	private static readonly StringCache s_Names = new(4096);
+
+	private readonly IntPtr m_Data;
+	private readonly int m_Length;
+	private readonly ulong m_Hash;
+
+	private unsafe ReadOnlySpan<byte> Utf8 => new(m_Data.ToPointer(), m_Length);
+
+	public override string ToString()
+	{
+		if (m_Data == IntPtr.Zero || m_Length <= 0)
+			return string.Empty;
+
+		return s_Names.Get(m_Hash, Utf8);
+	}
+
+	internal static void ClearCache() => s_Names.Clear();
+
+	public static implicit operator string(MemberName InName) => InName.ToString();
+}
+
 [StructLayout(LayoutKind.Explicit, Size=4)]
 public struct Bool32
 {
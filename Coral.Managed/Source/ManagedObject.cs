@@ -31,63 +31,14 @@ internal enum ManagedType
 
 	String,
 
-	Pointer
+	Pointer,
+
+	StringView
 };
 
 internal static class ManagedObject
 {
 
-	public readonly struct MethodKey : IEquatable<MethodKey>
-	{
-		public readonly string TypeName;
-		public readonly string Name;
-		public readonly ManagedType[] Types;
-		public readonly int ParameterCount;
-
-		public MethodKey(string InTypeName, string InName, ManagedType[] InTypes, int InParameterCount)
-		{
-			TypeName = InTypeName;
-			Name = InName;
-			Types = InTypes;
-			ParameterCount = InParameterCount;
-		}
-
-		public override bool Equals([NotNullWhen(true)] object? obj) => obj is MethodKey other && Equals(other);
-
-		bool IEquatable<MethodKey>.Equals(MethodKey other)
-		{
-			if (TypeName != other.TypeName || Name != other.Name)
-				return false;
-
-			for (int i = 0; i < Types.Length; i++)
-			{
-				if (Types[i] != other.Types[i])
-					return false;
-			}
-
-			return ParameterCount == other.ParameterCount;
-		}
-
-		public override int GetHashCode()
-		{
-			// NOTE(Peter): Josh Bloch's Hash (from https://stackoverflow.com/questions/263400/what-is-the-best-algorithm-for-overriding-gethashcode)
-			unchecked
-			{
-				int hash = 17;
-
-				hash = hash * 23 + TypeName.GetHashCode();
-				hash = hash * 23 + Name.GetHashCode();
-				foreach (var type in Types)
-					hash = hash * 23 + type.GetHashCode();
-				hash = hash * 23 + ParameterCount.GetHashCode();
-
-				return hash;
-			}
-		}
-	}
-
-	internal static Dictionary<MethodKey, MethodInfo> s_CachedMethods = new Dictionary<MethodKey, MethodInfo>();
-
 	static string TypeNameOrNull(Type? InType) {
 		if (InType != null) {
 			return InType.FullName != null ? InType.FullName : "<null>";
@@ -114,20 +65,12 @@ internal static class ManagedObject
 				return IntPtr.Zero;
 			}
 
-			ConstructorInfo? constructor = null;
+			var pool = InParameterCount == 0 && !InWeakRef && type != null ? ObjectPools.Find(type) : null;
 
-			var currentType = type;
-			while (currentType != null)
-			{
-				ReadOnlySpan<ConstructorInfo> constructors = currentType.GetConstructors(BindingFlags.NonPublic | BindingFlags.Public | BindingFlags.Instance);
-				
-				constructor = TypeInterface.FindSuitableMethod(".ctor", InParameterTypes, InParameterCount, constructors);
+			if (pool != null && pool.TryRent(out var pooledHandle))
+				return pooledHandle;
 
-				if (constructor != null)
-					break;
-
-				currentType = currentType.BaseType;
-			}
+			var constructor = type != null ? MethodIndices.GetConstructors(type).Find(".ctor", InParameterTypes, InParameterCount) : null;
 
 			if (constructor == null)
 			{
@@ -135,38 +78,47 @@ internal static class ManagedObject
 				return IntPtr.Zero;
 			}
 
-			var parameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, constructor);
-
-			object? result = null;
+			var result = ObjectFactories.Instantiate(ObjectFactories.Get(type!, constructor), InParameters, InParameterCount);
 
-			if (type == null)
+			if (result == null)
 			{
 				LogMessage($"Failed to instantiate type {TypeNameOrNull(type)}.", MessageLevel.Error);
 				return IntPtr.Zero;
 			}
 
-			if (currentType != type || parameters == null)
-			{
-				result = TypeInterface.CreateInstance(type);
+			return pool != null ? pool.Adopt(result) : AllocateHandle(result, InWeakRef);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
 
-				if (currentType != type)
-					constructor.Invoke(result, parameters);
-			}
-			else
-			{
-				result = TypeInterface.CreateInstance(type, parameters);
-			}
+	internal static IntPtr AllocateHandle(object InObject, bool InWeakRef)
+	{
+		if (!InWeakRef && IdentityMap.IsEnabled)
+			return IdentityMap.Acquire(InObject);
 
-			if (result == null)
+		var handle = GCHandle.Alloc(InObject, InWeakRef ? GCHandleType.Weak : GCHandleType.Normal);
+		HandleRegistry.Register(handle, InObject.GetType());
+		return GCHandle.ToIntPtr(handle);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe IntPtr CopyObject(IntPtr InObjectHandle)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+
+			if (target == null)
 			{
-				LogMessage($"Failed to instantiate type {TypeNameOrNull(type)}.", MessageLevel.Error);
+				LogMessage($"Cannot copy object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
+				return IntPtr.Zero;
 			}
 
-			var handle = GCHandle.Alloc(result, InWeakRef ? GCHandleType.Weak : GCHandleType.Normal);
-#if DEBUG
-			AssemblyLoader.RegisterHandle(type.Assembly, handle);
-#endif
-			return GCHandle.ToIntPtr(handle);
+			return AllocateHandle(target, false);
 		}
 		catch (Exception ex)
 		{
@@ -175,24 +127,19 @@ internal static class ManagedObject
 		}
 	}
 
+	// InObjectHandle can be a strong or a weak handle, returns null if the object has already been collected
 	[UnmanagedCallersOnly]
-	internal static unsafe IntPtr CopyObject(IntPtr InObjectHandle)
+	internal static IntPtr CreateWeakHandle(IntPtr InObjectHandle, Bool32 InTrackResurrection)
 	{
 		try
 		{
 			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
 
 			if (target == null)
-			{
-				LogMessage($"Cannot copy object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
 				return IntPtr.Zero;
-			}
 
-			var handle = GCHandle.Alloc(target, GCHandleType.Normal);
-#if DEBUG
-			var type = target.GetType();
-			AssemblyLoader.RegisterHandle(type.Assembly, handle);
-#endif
+			var handle = GCHandle.Alloc(target, InTrackResurrection ? GCHandleType.WeakTrackResurrection : GCHandleType.Weak);
+			HandleRegistry.Register(handle, target.GetType());
 			return GCHandle.ToIntPtr(handle);
 		}
 		catch (Exception ex)
@@ -203,77 +150,97 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void DestroyObject(IntPtr InObjectHandle)
+	internal static Bool32 IsHandleAlive(IntPtr InObjectHandle)
 	{
 		try
 		{
-			GCHandle handle = GCHandle.FromIntPtr(InObjectHandle);
-#if DEBUG
-			var type = handle.Target?.GetType();
-			if (type is not null) {
-				AssemblyLoader.DeregisterHandle(type.Assembly, handle);
-			}
-#endif
-			handle.Free();
+			return GCHandle.FromIntPtr(InObjectHandle).Target != null;
 		}
 		catch (Exception ex)
 		{
 			HandleException(ex);
+			return false;
 		}
 	}
 
-	private static unsafe MethodInfo? TryGetMethodInfo(Type InType, string? InMethodName, ManagedType* InParameterTypes, int InParameterCount, BindingFlags InBindingFlags)
+	// Unlike CopyObject a collected target isn't an error, native code gets an invalid handle back
+	[UnmanagedCallersOnly]
+	internal static IntPtr LockWeakHandle(IntPtr InObjectHandle)
 	{
-		MethodInfo? methodInfo = null;
+		try
+		{
+			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+			return target != null ? AllocateHandle(target, false) : IntPtr.Zero;
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
 
-		var parameterTypes = new ManagedType[InParameterCount];
+	internal static void FreeHandle(IntPtr InObjectHandle)
+	{
+		GCHandle handle = GCHandle.FromIntPtr(InObjectHandle);
+
+		if (IdentityMap.Release(handle) || ObjectPools.Return(handle))
+			return;
 
-		if (InMethodName == null) return null;
+		HandleRegistry.Deregister(handle);
+		handle.Free();
+	}
 
-		unsafe
+	[UnmanagedCallersOnly]
+	internal static void DestroyObject(IntPtr InObjectHandle)
+	{
+		try
 		{
-			fixed (ManagedType* parameterTypesPtr = parameterTypes)
-			{
-				ulong size = sizeof(ManagedType) * (ulong)InParameterCount;
-				Buffer.MemoryCopy(InParameterTypes, parameterTypesPtr, size, size);
-			}
+			FreeHandle(InObjectHandle);
 		}
-
-		var methodKey = new MethodKey(TypeNameOrNull(InType), InMethodName, parameterTypes, InParameterCount);
-
-		if (!s_CachedMethods.TryGetValue(methodKey, out methodInfo))
+		catch (Exception ex)
 		{
-			List<MethodInfo> methods = new(InType.GetMethods(InBindingFlags));
+			HandleException(ex);
+		}
+	}
 
-			Type? baseType = InType.BaseType;
-			while (baseType != null)
+	// Frees the handles queued by the native DestroyQueue, a bad handle doesn't stop the rest from being freed
+	[UnmanagedCallersOnly]
+	internal static unsafe void DestroyObjects(IntPtr* InObjectHandles, int InCount)
+	{
+		for (int i = 0; i < InCount; i++)
+		{
+			try
 			{
-				methods.AddRange(baseType.GetMethods(InBindingFlags));
-				baseType = baseType.BaseType;
+				FreeHandle(InObjectHandles[i]);
 			}
-
-			methodInfo = TypeInterface.FindSuitableMethod<MethodInfo>(InMethodName, InParameterTypes, InParameterCount, CollectionsMarshal.AsSpan(methods));
-
-			if (methodInfo == null)
+			catch (Exception ex)
 			{
-				LogMessage($"Failed to find method '{InMethodName}' for type {InType.FullName} with {InParameterCount} parameters.", MessageLevel.Error);
-				return null;
+				HandleException(ex);
 			}
-
-			s_CachedMethods.Add(methodKey, methodInfo);
 		}
+	}
+
+	private static unsafe MethodInfo? TryGetMethodInfo(Type InType, string? InMethodName, ManagedType* InParameterTypes, int InParameterCount, BindingFlags InBindingFlags)
+	{
+		if (InMethodName == null)
+			return null;
+
+		var methodInfo = MethodIndices.GetMethods(InType, InBindingFlags).Find(InMethodName, InParameterTypes, InParameterCount);
+
+		if (methodInfo == null)
+			LogMessage($"Failed to find method '{InMethodName}' for type {InType.FullName} with {InParameterCount} parameters.", MessageLevel.Error);
 
 		return methodInfo;
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeStaticMethod(int InType, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
+	internal static unsafe void InvokeStaticMethod(int InType, MemberName InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
 	{
 		try
 		{
 			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
 			{
-				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				LogMessage($"Cannot invoke method {InMethodName} on a null type.", MessageLevel.Error);
 				return;
 			}
 			
@@ -281,7 +248,15 @@ internal static class ManagedObject
 
 			if (methodInfo == null)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Failed to get method info for {InMethodName}.", MessageLevel.Error);
+				return;
+			}
+
+			var invoker = MethodInvokers.Get(methodInfo);
+
+			if (invoker != null)
+			{
+				invoker(null, InParameters, IntPtr.Zero);
 				return;
 			}
 
@@ -296,13 +271,13 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeStaticMethodRet(int InType, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
+	internal static unsafe void InvokeStaticMethodRet(int InType, MemberName InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
 	{
 		try
 		{
 			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
 			{
-				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				LogMessage($"Cannot invoke method {InMethodName} on a null type.", MessageLevel.Error);
 				return;
 			}
 
@@ -310,7 +285,15 @@ internal static class ManagedObject
 
 			if (methodInfo == null)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Failed to get method info for {InMethodName}.", MessageLevel.Error);
+				return;
+			}
+
+			var invoker = MethodInvokers.Get(methodInfo);
+
+			if (invoker != null)
+			{
+				invoker(null, InParameters, InResultStorage);
 				return;
 			}
 
@@ -330,7 +313,7 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeMethod(IntPtr InObjectHandle, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
+	internal static unsafe void InvokeMethod(IntPtr InObjectHandle, MemberName InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount)
 	{
 		try
 		{
@@ -338,7 +321,7 @@ internal static class ManagedObject
 
 			if (target == null)
 			{
-				LogMessage($"Cannot invoke method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				LogMessage($"Cannot invoke method {InMethodName} on a null type.", MessageLevel.Error);
 				return;
 			}
 
@@ -348,7 +331,15 @@ internal static class ManagedObject
 
 			if (methodInfo == null)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Failed to get method info for {InMethodName}.", MessageLevel.Error);
+				return;
+			}
+
+			var invoker = MethodInvokers.Get(methodInfo);
+
+			if (invoker != null)
+			{
+				invoker(target, InParameters, IntPtr.Zero);
 				return;
 			}
 
@@ -363,7 +354,7 @@ internal static class ManagedObject
 	}
 	
 	[UnmanagedCallersOnly]
-	internal static unsafe void InvokeMethodRet(IntPtr InObjectHandle, NativeString InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
+	internal static unsafe void InvokeMethodRet(IntPtr InObjectHandle, MemberName InMethodName, IntPtr InParameters, ManagedType* InParameterTypes, int InParameterCount, IntPtr InResultStorage)
 	{
 		try
 		{
@@ -381,7 +372,15 @@ internal static class ManagedObject
 
 			if (methodInfo == null)
 			{
-				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				LogMessage($"Failed to get method info for {InMethodName}.", MessageLevel.Error);
+				return;
+			}
+
+			var invoker = MethodInvokers.Get(methodInfo);
+
+			if (invoker != null)
+			{
+				invoker(target, InParameters, InResultStorage);
 				return;
 			}
 
@@ -401,59 +400,350 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void SetFieldValue(IntPtr InTarget, NativeString InFieldName, IntPtr InValue)
+	internal static unsafe int ResolveMethod(int InType, NativeString InMethodName, ManagedType* InParameterTypes, int InParameterCount)
 	{
 		try
 		{
-			var target = GCHandle.FromIntPtr(InTarget).Target;
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot resolve method {NativeStringOrNull(InMethodName)} on a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			var methodInfo = TryGetMethodInfo(type, InMethodName, InParameterTypes, InParameterCount, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static);
+
+			if (methodInfo == null)
+			{
+				LogMessage($"Failed to get method info for {NativeStringOrNull(InMethodName)}.", MessageLevel.Error);
+				return -1;
+			}
+
+			return TypeInterface.s_CachedMethods.Add(methodInfo);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	private static MethodInfo? GetResolvedMethod(int InMethodHandle, int InParameterCount)
+	{
+		if (!TypeInterface.s_CachedMethods.TryGetValue(InMethodHandle, out var methodInfo) || methodInfo == null)
+		{
+			LogMessage($"Failed to find method with handle '{InMethodHandle}'.", MessageLevel.Error);
+			return null;
+		}
+
+		int expectedParameterCount = MethodIndices.GetParameterCount(methodInfo);
+
+		if (expectedParameterCount != InParameterCount)
+		{
+			LogMessage($"Method '{methodInfo.Name}' expects {expectedParameterCount} parameters but {InParameterCount} were passed.", MessageLevel.Error);
+			return null;
+		}
+
+		return methodInfo;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void InvokeMethodHandle(IntPtr InObjectHandle, int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
 
 			if (target == null)
 			{
-				LogMessage($"Cannot set value of field {InFieldName} on object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				LogMessage($"Cannot invoke method with handle {InMethodHandle} on object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
 				return;
 			}
 
-			var targetType = target.GetType();
-			var fieldInfo = targetType.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			InvokeResolvedMethod(target, InMethodHandle, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
 
-			if (fieldInfo == null)
+	internal static void InvokeResolvedMethod(object InTarget, int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		var methodInfo = GetResolvedMethod(InMethodHandle, InParameterCount);
+
+		if (methodInfo == null)
+			return;
+
+		var invoker = MethodInvokers.Get(methodInfo);
+
+		if (invoker != null)
+		{
+			invoker(InTarget, InParameters, InResultStorage);
+			return;
+		}
+
+		var methodParameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
+
+		object? value = methodInfo.Invoke(methodInfo.IsStatic ? null : InTarget, methodParameters);
+
+		if (value == null || InResultStorage == IntPtr.Zero)
+			return;
+
+		Marshalling.MarshalReturnValue(InTarget, value, methodInfo, InResultStorage);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void InvokeStaticMethodHandle(int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			var methodInfo = GetResolvedMethod(InMethodHandle, InParameterCount);
+
+			if (methodInfo == null)
+				return;
+
+			if (!methodInfo.IsStatic)
 			{
-				LogMessage($"Failed to find field '{InFieldName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+				LogMessage($"Cannot invoke instance method '{methodInfo.Name}' without a target.", MessageLevel.Error);
 				return;
 			}
 
-			if (fieldInfo.FieldType == typeof(string))
+			var invoker = MethodInvokers.Get(methodInfo);
+
+			if (invoker != null)
 			{
-				object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(NativeString));
+				invoker(null, InParameters, InResultStorage);
+				return;
+			}
+
+			var methodParameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
+
+			object? value = methodInfo.Invoke(null, methodParameters);
+
+			if (value == null || InResultStorage == IntPtr.Zero)
+				return;
 
-				if (fieldValue == null)
+			Marshalling.MarshalReturnValue(null, value, methodInfo, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	// InObjects holds InObjectCount object handles that are InObjectStride bytes apart, which allows passing both an array of
+	// ManagedObjects and a plain array of handles. Object i reads its parameters from InParameters + i * InParameterStride, so a
+	// stride of 0 shares a single parameter block. Return values are discarded, OutResults (optional) receives whether each call succeeded.
+	[UnmanagedCallersOnly]
+	internal static unsafe int InvokeMethodBatch(IntPtr InObjects, int InObjectStride, int InObjectCount, int InMethodHandle, IntPtr InParameters, int InParameterCount, int InParameterStride, Bool32* OutResults)
+	{
+		return InvokeBatch(InObjects, InObjectStride, InObjectCount, false, InMethodHandle, InParameters, InParameterCount, InParameterStride, OutResults);
+	}
+
+	// With InObjectRefs set InObjects holds ObjectTable references instead of GCHandles
+	internal static unsafe int InvokeBatch(IntPtr InObjects, int InObjectStride, int InObjectCount, bool InObjectRefs, int InMethodHandle, IntPtr InParameters, int InParameterCount, int InParameterStride, Bool32* OutResults)
+	{
+		int failedCount = 0;
+
+		try
+		{
+			var methodInfo = GetResolvedMethod(InMethodHandle, InParameterCount);
+
+			if (methodInfo != null && methodInfo.IsStatic)
+			{
+				LogMessage($"Cannot batch invoke static method '{methodInfo.Name}'.", MessageLevel.Error);
+				methodInfo = null;
+			}
+
+			if (methodInfo == null)
+			{
+				if (OutResults != null)
 				{
-					LogMessage($"Failed to get field '{InFieldName}' value in type '{targetType.FullName}'.", MessageLevel.Error);
-					return;
+					for (int i = 0; i < InObjectCount; i++)
+						OutResults[i] = false;
 				}
 
-				NativeString value = (NativeString) fieldValue;
-				fieldInfo.SetValue(target, value.ToString());
+				return InObjectCount;
 			}
-			else if (fieldInfo.FieldType == typeof(bool))
+
+			var invoker = MethodInvokers.Get(methodInfo);
+
+			// Shared parameters only have to be marshalled once when falling back to reflection
+			object?[]? sharedParameters = null;
+
+			if (invoker == null && InParameterStride == 0)
+				sharedParameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, methodInfo);
+
+			for (int i = 0; i < InObjectCount; i++)
 			{
-				object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(Bool32));
+				bool succeeded = false;
 
-				if (fieldValue == null)
+				// Each object is isolated, an exception only fails the call for that object
+				try
 				{
-					LogMessage($"Failed to get field '{InFieldName}' value in type '{targetType.FullName}'.", MessageLevel.Error);
-					return;
+					var objectHandle = *(IntPtr*)((byte*)InObjects + (nint)i * InObjectStride);
+					var target = InObjectRefs ? ObjectTable.Get((ulong)objectHandle) : GCHandle.FromIntPtr(objectHandle).Target;
+
+					if (target == null)
+					{
+						LogMessage($"Cannot invoke method '{methodInfo.Name}' on object with handle {objectHandle}. Target was null.", MessageLevel.Error);
+					}
+					else
+					{
+						var parameters = InParameters + (nint)i * InParameterStride;
+
+						if (invoker != null)
+							invoker(target, parameters, IntPtr.Zero);
+						else
+							methodInfo.Invoke(target, sharedParameters ?? Marshalling.MarshalParameterArray(parameters, InParameterCount, methodInfo));
+
+						succeeded = true;
+					}
 				}
+				catch (TargetInvocationException ex)
+				{
+					HandleException(ex.InnerException ?? ex);
+				}
+				catch (Exception ex)
+				{
+					HandleException(ex);
+				}
+
+				if (!succeeded)
+					failedCount++;
+
+				if (OutResults != null)
+					OutResults[i] = succeeded;
+			}
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+
+		return failedCount;
+	}
+
+	internal static void SetFieldValueInternal(object InTarget, FieldInfo InFieldInfo, IntPtr InValue)
+	{
+		var setter = MemberAccessors.GetSetter(InFieldInfo);
+
+		if (setter != null)
+		{
+			setter(InTarget, InValue);
+			return;
+		}
+
+		if (InFieldInfo.FieldType == typeof(string))
+		{
+			object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(NativeString));
+
+			if (fieldValue == null)
+			{
+				LogMessage($"Failed to get field '{InFieldInfo.Name}' value in type '{InFieldInfo.DeclaringType?.FullName}'.", MessageLevel.Error);
+				return;
+			}
+
+			NativeString value = (NativeString) fieldValue;
+			InFieldInfo.SetValue(InTarget, StringInterning.Decode(value.m_NativeString));
+		}
+		else if (InFieldInfo.FieldType == typeof(bool))
+		{
+			object? fieldValue = Marshalling.MarshalPointer(InValue, typeof(Bool32));
 
-				Bool32 value = (Bool32) fieldValue;
-				fieldInfo.SetValue(target, (bool) value);
+			if (fieldValue == null)
+			{
+				LogMessage($"Failed to get field '{InFieldInfo.Name}' value in type '{InFieldInfo.DeclaringType?.FullName}'.", MessageLevel.Error);
+				return;
 			}
-			else
+
+			Bool32 value = (Bool32) fieldValue;
+			InFieldInfo.SetValue(InTarget, (bool) value);
+		}
+		else
+		{
+			object? value = Marshalling.MarshalPointer(InValue, InFieldInfo.FieldType);
+
+			InFieldInfo.SetValue(InTarget, value);
+		}
+	}
+
+	internal static void GetFieldValueInternal(object InTarget, FieldInfo InFieldInfo, IntPtr OutValue)
+	{
+		var getter = MemberAccessors.GetGetter(InFieldInfo);
+
+		if (getter != null)
+		{
+			getter(InTarget, OutValue);
+			return;
+		}
+
+		// Handles strings gracefully internally.
+		Marshalling.MarshalReturnValue(InTarget, InFieldInfo.GetValue(InTarget), InFieldInfo, OutValue);
+	}
+
+	private static void SetPropertyValueInternal(object InTarget, PropertyInfo InPropertyInfo, IntPtr InValue)
+	{
+		if (InPropertyInfo.SetMethod == null)
+		{
+			LogMessage($"Cannot set value of property '{InPropertyInfo.Name}'. No setter was found.", MessageLevel.Error);
+			return;
+		}
+
+		var setter = MemberAccessors.GetSetter(InPropertyInfo);
+
+		if (setter != null)
+		{
+			setter(InTarget, InValue);
+			return;
+		}
+
+		object? value = Marshalling.MarshalPointer(InValue, InPropertyInfo.PropertyType);
+		InPropertyInfo.SetValue(InTarget, value);
+	}
+
+	private static void GetPropertyValueInternal(object InTarget, PropertyInfo InPropertyInfo, IntPtr OutValue)
+	{
+		if (InPropertyInfo.GetMethod == null)
+		{
+			LogMessage($"Cannot get value of property '{InPropertyInfo.Name}'. No getter was found.", MessageLevel.Error);
+			return;
+		}
+
+		var getter = MemberAccessors.GetGetter(InPropertyInfo);
+
+		if (getter != null)
+		{
+			getter(InTarget, OutValue);
+			return;
+		}
+
+		Marshalling.MarshalReturnValue(InTarget, InPropertyInfo.GetValue(InTarget), InPropertyInfo, OutValue);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetFieldValue(IntPtr InTarget, MemberName InFieldName, IntPtr InValue)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InTarget).Target;
+
+			if (target == null)
 			{
-				object? value = Marshalling.MarshalPointer(InValue, fieldInfo.FieldType);
+				LogMessage($"Cannot set value of field {InFieldName} on object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				return;
+			}
 
-				fieldInfo.SetValue(target, value);
+			var targetType = target.GetType();
+			var fieldInfo = targetType.GetField(InFieldName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+
+			if (fieldInfo == null)
+			{
+				LogMessage($"Failed to find field '{InFieldName}' in type '{targetType.FullName}'.", MessageLevel.Error);
+				return;
 			}
+
+			SetFieldValueInternal(target, fieldInfo, InValue);
 		}
 		catch (Exception ex)
 		{
@@ -462,7 +752,7 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void GetFieldValue(IntPtr InTarget, NativeString InFieldName, IntPtr OutValue)
+	internal static void GetFieldValue(IntPtr InTarget, MemberName InFieldName, IntPtr OutValue)
 	{
 		try
 		{
@@ -475,7 +765,7 @@ internal static class ManagedObject
 			}
 
 			var targetType = target.GetType();
-			var fieldInfo = targetType.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var fieldInfo = targetType.GetField(InFieldName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
 
 			if (fieldInfo == null)
 			{
@@ -483,8 +773,7 @@ internal static class ManagedObject
 				return;
 			}
 
-			// Handles strings gracefully internally.
-			Marshalling.MarshalReturnValue(target, fieldInfo.GetValue(target), fieldInfo, OutValue);
+			GetFieldValueInternal(target, fieldInfo, OutValue);
 		}
 		catch (Exception ex)
 		{
@@ -493,7 +782,7 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void SetPropertyValue(IntPtr InTarget, NativeString InPropertyName, IntPtr InValue)
+	internal static void SetPropertyValue(IntPtr InTarget, MemberName InPropertyName, IntPtr InValue)
 	{
 		try
 		{
@@ -506,7 +795,7 @@ internal static class ManagedObject
 			}
 
 			var targetType = target.GetType();
-			var propertyInfo = targetType.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var propertyInfo = targetType.GetProperty(InPropertyName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
 		
 			if (propertyInfo == null)
 			{
@@ -514,14 +803,7 @@ internal static class ManagedObject
 				return;
 			}
 
-			if (propertyInfo.SetMethod == null)
-			{
-				LogMessage($"Cannot set value of property '{InPropertyName}'. No setter was found.", MessageLevel.Error);
-				return;
-			}
-
-			object? value = Marshalling.MarshalPointer(InValue, propertyInfo.PropertyType);
-			propertyInfo.SetValue(target, value);
+			SetPropertyValueInternal(target, propertyInfo, InValue);
 		}
 		catch (Exception ex)
 		{
@@ -530,7 +812,7 @@ internal static class ManagedObject
 	}
 
 	[UnmanagedCallersOnly]
-	internal static void GetPropertyValue(IntPtr InTarget, NativeString InPropertyName, IntPtr OutValue)
+	internal static void GetPropertyValue(IntPtr InTarget, MemberName InPropertyName, IntPtr OutValue)
 	{
 		try
 		{
@@ -543,7 +825,7 @@ internal static class ManagedObject
 			}
 
 			var targetType = target.GetType();
-			var propertyInfo = targetType.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
+			var propertyInfo = targetType.GetProperty(InPropertyName, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance);
 
 			if (propertyInfo == null)
 			{
@@ -551,13 +833,171 @@ internal static class ManagedObject
 				return;
 			}
 
-			if (propertyInfo.GetMethod == null)
+			GetPropertyValueInternal(target, propertyInfo, OutValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static int ResolveField(int InType, NativeString InFieldName)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot resolve field {NativeStringOrNull(InFieldName)} on a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			var fieldInfo = type.GetField(InFieldName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static);
+
+			if (fieldInfo == null)
+			{
+				LogMessage($"Failed to find field '{InFieldName}' in type '{type.FullName}'.", MessageLevel.Error);
+				return -1;
+			}
+
+			return TypeInterface.s_CachedFields.Add(fieldInfo);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static int ResolveProperty(int InType, NativeString InPropertyName)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage($"Cannot resolve property {NativeStringOrNull(InPropertyName)} on a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			var propertyInfo = type.GetProperty(InPropertyName!, BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.Static);
+
+			if (propertyInfo == null)
+			{
+				LogMessage($"Failed to find property '{InPropertyName}' in type '{type.FullName}'.", MessageLevel.Error);
+				return -1;
+			}
+
+			return TypeInterface.s_CachedProperties.Add(propertyInfo);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetFieldValueByHandle(IntPtr InTarget, int InFieldHandle, IntPtr InValue)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InTarget).Target;
+
+			if (target == null)
+			{
+				LogMessage($"Cannot set value of field with handle {InFieldHandle} on object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				return;
+			}
+
+			if (!TypeInterface.s_CachedFields.TryGetValue(InFieldHandle, out var fieldInfo) || fieldInfo == null)
+			{
+				LogMessage($"Failed to find field with handle '{InFieldHandle}'.", MessageLevel.Error);
+				return;
+			}
+
+			SetFieldValueInternal(target, fieldInfo, InValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void GetFieldValueByHandle(IntPtr InTarget, int InFieldHandle, IntPtr OutValue)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InTarget).Target;
+
+			if (target == null)
+			{
+				LogMessage($"Cannot get value of field with handle {InFieldHandle} from object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				return;
+			}
+
+			if (!TypeInterface.s_CachedFields.TryGetValue(InFieldHandle, out var fieldInfo) || fieldInfo == null)
+			{
+				LogMessage($"Failed to find field with handle '{InFieldHandle}'.", MessageLevel.Error);
+				return;
+			}
+
+			GetFieldValueInternal(target, fieldInfo, OutValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetPropertyValueByHandle(IntPtr InTarget, int InPropertyHandle, IntPtr InValue)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InTarget).Target;
+
+			if (target == null)
+			{
+				LogMessage($"Cannot set value of property with handle {InPropertyHandle} on object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				return;
+			}
+
+			if (!TypeInterface.s_CachedProperties.TryGetValue(InPropertyHandle, out var propertyInfo) || propertyInfo == null)
+			{
+				LogMessage($"Failed to find property with handle '{InPropertyHandle}'.", MessageLevel.Error);
+				return;
+			}
+
+			SetPropertyValueInternal(target, propertyInfo, InValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void GetPropertyValueByHandle(IntPtr InTarget, int InPropertyHandle, IntPtr OutValue)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InTarget).Target;
+
+			if (target == null)
+			{
+				LogMessage($"Cannot get value of property with handle {InPropertyHandle} from object with handle {InTarget}. Target was null.", MessageLevel.Error);
+				return;
+			}
+
+			if (!TypeInterface.s_CachedProperties.TryGetValue(InPropertyHandle, out var propertyInfo) || propertyInfo == null)
 			{
-				LogMessage($"Cannot get value of property '{InPropertyName}'. No getter was found.", MessageLevel.Error);
+				LogMessage($"Failed to find property with handle '{InPropertyHandle}'.", MessageLevel.Error);
 				return;
 			}
 
-			Marshalling.MarshalReturnValue(target, propertyInfo.GetValue(target), propertyInfo, OutValue);
+			GetPropertyValueInternal(target, propertyInfo, OutValue);
 		}
 		catch (Exception ex)
 		{
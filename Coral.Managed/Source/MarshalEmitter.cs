@@ -0,0 +1,151 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+// Emits the IL equivalent of Marshalling.MarshalPointer / Marshalling.MarshalReturnValue for a known type,
+// so compiled stubs can move values between native memory and the managed stack without boxing.
+internal static class MarshalEmitter
+{
+	private static readonly ConcurrentDictionary<Type, bool> s_BlittableTypes = new();
+
+	private static readonly MethodInfo s_ReadStringMethod = typeof(MarshalEmitter).GetMethod(nameof(ReadString), BindingFlags.NonPublic | BindingFlags.Static)!;
+	private static readonly MethodInfo s_ReadObjectMethod = typeof(MarshalEmitter).GetMethod(nameof(ReadObject), BindingFlags.NonPublic | BindingFlags.Static)!;
+	private static readonly MethodInfo s_ToNativeStringMethod = typeof(NativeString).GetMethod("op_Implicit", [typeof(string)])!;
+	private static readonly MethodInfo s_GetTypeFromHandleMethod = typeof(Type).GetMethod(nameof(Type.GetTypeFromHandle), [typeof(RuntimeTypeHandle)])!;
+	private static readonly MethodInfo s_MarshalPointerMethod = typeof(Marshalling).GetMethod(nameof(Marshalling.MarshalPointer), [typeof(IntPtr), typeof(Type)])!;
+
+	internal static unsafe string? ReadString(IntPtr InValue) => StringInterning.Decode(((NativeString*)InValue)->m_NativeString);
+
+	internal static unsafe object? ReadObject(IntPtr InValue) => GCHandle.FromIntPtr(*(IntPtr*)InValue).Target;
+
+	// Types that have the same layout in managed and native memory, bool and char are excluded
+	// because Marshal.SizeOf / PtrToStructure treat them differently from their managed representation.
+	internal static bool IsBlittable(Type InType)
+	{
+		return s_BlittableTypes.GetOrAdd(InType, static type =>
+		{
+			if (type.IsPrimitive)
+				return type != typeof(bool) && type != typeof(char);
+
+			if (type.IsEnum || type.IsPointer)
+				return true;
+
+			if (!type.IsValueType || type.IsGenericType || type.IsAutoLayout)
+				return false;
+
+			foreach (var field in type.GetFields(BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance))
+			{
+				if (!IsBlittable(field.FieldType))
+					return false;
+			}
+
+			return true;
+		});
+	}
+
+	internal static bool CanEmitParameter(Type InType)
+	{
+		// Parameters we don't have a fast path for go through Marshalling.MarshalPointer, only by-ref parameters can't be handled
+		return !InType.IsByRef && !InType.IsByRefLike && !InType.ContainsGenericParameters;
+	}
+
+	internal static bool CanEmitReturn(Type InType)
+	{
+		return InType == typeof(void) || InType.IsPointer || InType == typeof(IntPtr) || InType == typeof(bool) || InType == typeof(string) || IsBlittable(InType);
+	}
+
+	// Expects the address of the native value on the stack, leaves the managed value of type InType
+	internal static void EmitReadParameter(ILGenerator InIL, Type InType) => EmitRead(InIL, InType, false);
+
+	// Same as EmitReadParameter except that bools are read as Bool32, which is what native code passes for field values
+	internal static void EmitReadField(ILGenerator InIL, Type InType) => EmitRead(InIL, InType, true);
+
+	private static void EmitRead(ILGenerator InIL, Type InType, bool InBoolAsBool32)
+	{
+		if (InType.IsPointer || InType == typeof(IntPtr))
+		{
+			// The native side passes pointers by value, so the address is the value
+			return;
+		}
+
+		if (InType == typeof(bool))
+		{
+			InIL.Emit(InBoolAsBool32 ? OpCodes.Ldind_U4 : OpCodes.Ldind_U1);
+			InIL.Emit(OpCodes.Ldc_I4_0);
+			InIL.Emit(OpCodes.Cgt_Un);
+		}
+		else if (InType == typeof(string))
+		{
+			InIL.Emit(OpCodes.Call, s_ReadStringMethod);
+		}
+		else if (IsBlittable(InType))
+		{
+			InIL.Emit(OpCodes.Ldobj, InType);
+		}
+		else if (InType.IsClass && !InType.IsSZArray)
+		{
+			InIL.Emit(OpCodes.Call, s_ReadObjectMethod);
+			InIL.Emit(OpCodes.Castclass, InType);
+		}
+		else
+		{
+			InIL.Emit(OpCodes.Ldtoken, InType);
+			InIL.Emit(OpCodes.Call, s_GetTypeFromHandleMethod);
+			InIL.Emit(OpCodes.Call, s_MarshalPointerMethod);
+			InIL.Emit(OpCodes.Unbox_Any, InType);
+		}
+	}
+
+	// Writes the value stored in InValue to the native address in argument InStorageArgument, matches
+	// Marshalling.MarshalReturnValue in that null strings leave the storage untouched
+	internal static void EmitWriteResult(ILGenerator InIL, Type InType, LocalBuilder InValue, short InStorageArgument)
+	{
+		var skipLabel = InIL.DefineLabel();
+
+		if (InType == typeof(string))
+		{
+			InIL.Emit(OpCodes.Ldloc, InValue);
+			InIL.Emit(OpCodes.Brfalse, skipLabel);
+		}
+
+		InIL.Emit(OpCodes.Ldarg, InStorageArgument);
+		InIL.Emit(OpCodes.Ldloc, InValue);
+		EmitStore(InIL, InType);
+
+		InIL.MarkLabel(skipLabel);
+	}
+
+	// Expects the native address and then the managed value of type InType on the stack
+	internal static void EmitStore(ILGenerator InIL, Type InType)
+	{
+		if (InType.IsPointer || InType == typeof(IntPtr))
+		{
+			InIL.Emit(OpCodes.Stind_I);
+		}
+		else if (InType == typeof(bool))
+		{
+			// Bool32
+			InIL.Emit(OpCodes.Stind_I4);
+		}
+		else if (InType == typeof(string))
+		{
+			InIL.Emit(OpCodes.Call, s_ToNativeStringMethod);
+			InIL.Emit(OpCodes.Stobj, typeof(NativeString));
+		}
+		else
+		{
+			InIL.Emit(OpCodes.Stobj, InType);
+		}
+	}
+
+	internal static void Clear()
+	{
+		s_BlittableTypes.Clear();
+	}
+}
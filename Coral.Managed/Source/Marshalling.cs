@@ -1,8 +1,10 @@
 ﻿using Coral.Managed.Interop;
 
 using System;
+using System.Collections.Concurrent;
 using System.Linq;
 using System.Reflection;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 
 namespace Coral.Managed;
@@ -33,6 +35,9 @@ public static class Marshalling
 	}
 #pragma warning restore 0649
 
+	private static readonly ConcurrentDictionary<Type, Action<object, IntPtr>?> s_ValueWriters = new();
+	private static readonly MethodInfo s_WriteValueMethod = typeof(Marshalling).GetMethod(nameof(WriteValue), BindingFlags.NonPublic | BindingFlags.Static)!;
+
 	public static void MarshalReturnValue(object? InTarget, object? InValue, MemberInfo? InMemberInfo, IntPtr OutValue)
 	{
 		if (InMemberInfo == null)
@@ -55,31 +60,19 @@ public static class Marshalling
 
 		if (type != null && type.IsSZArray)
 		{
-			var fieldArray = ArrayStorage.GetFieldArray(InTarget, InValue, InMemberInfo);
-
-			if (fieldArray != null)
-			{
-				Marshal.WriteIntPtr(OutValue, fieldArray.Value.AddrOfPinnedObject());
-			}
-			else
-			{
-				Marshal.WriteIntPtr(OutValue, IntPtr.Zero);
-			}
+			ArrayPins.WriteView(InValue as Array, OutValue);
 		}
 		else if (type == typeof(string) && InValue != null)
 		{
-			NativeString nativeString = (NativeString) (string) InValue;
-			Marshal.StructureToPtr(nativeString, OutValue, false);
+			unsafe { *(NativeString*)OutValue = (string)InValue; }
 		}
 		else if (type == typeof(bool) && InValue != null)
 		{
-			Bool32 value = (Bool32) (bool) InValue;
-			Marshal.StructureToPtr(value, OutValue, false);
+			unsafe { *(Bool32*)OutValue = (bool)InValue; }
 		}
 		else if (type == typeof(NativeString) && InValue != null)
 		{
-			NativeString nativeString = (NativeString) InValue;
-			Marshal.StructureToPtr((NativeString) InValue, OutValue, false);
+			unsafe { *(NativeString*)OutValue = (NativeString)InValue; }
 		}
 		else if (type != null && type.IsPointer)
 		{
@@ -96,6 +89,10 @@ public static class Marshalling
 				}
 			}
 		}
+		else if (type != null && InValue != null && GetValueWriter(type) is { } writer)
+		{
+			writer(InValue, OutValue);
+		}
 		else if (type != null)
 		{
 			int valueSize = type.IsEnum ? Marshal.SizeOf(Enum.GetUnderlyingType(type)) : Marshal.SizeOf(type);
@@ -111,6 +108,23 @@ public static class Marshalling
 		else throw new ArgumentNullException("InMemberInfo:Type");
 	}
 
+	// Writes a boxed blittable value straight into native memory, null for types that still have to go through Marshal.SizeOf
+	private static Action<object, IntPtr>? GetValueWriter(Type InType)
+	{
+		return s_ValueWriters.GetOrAdd(InType, static type =>
+		{
+			if (!MarshalEmitter.IsBlittable(type))
+				return null;
+
+			return s_WriteValueMethod.MakeGenericMethod(type).CreateDelegate<Action<object, IntPtr>>();
+		});
+	}
+
+	private static unsafe void WriteValue<T>(object InValue, IntPtr OutValue) where T : unmanaged
+	{
+		Unsafe.Write(OutValue.ToPointer(), (T)InValue);
+	}
+
 	public static object? MarshalArray(IntPtr InArray, Type? InElementType)
 	{
 		if (InElementType == null)
@@ -122,26 +136,30 @@ public static class Marshalling
 		{
 			var arrayContainer = MarshalPointer<ValueArrayContainer>(InArray);
 
-			if (ArrayStorage.HasFieldArray(null, null))
-			{
-				var fieldArray = ArrayStorage.GetFieldArray(null, null, null);
-
-				if (arrayContainer.Data == fieldArray!.Value.AddrOfPinnedObject())
-				{
-					return fieldArray.Value.Target;
-				}
-			}
-
 			result = Array.CreateInstance(InElementType, arrayContainer.Length);
 
-			int elementSize = Marshal.SizeOf(InElementType);
+			int elementSize = Marshal.SizeOf(InElementType.IsEnum ? Enum.GetUnderlyingType(InElementType) : InElementType);
 
 			unsafe
 			{
-				for (int i = 0; i < arrayContainer.Length; i++)
+				if (MarshalEmitter.IsBlittable(InElementType))
+				{
+					// Native and managed elements have the same layout, so the whole array is a single copy
+					long byteCount = (long)elementSize * arrayContainer.Length;
+
+					if (byteCount > 0)
+					{
+						fixed (byte* destination = &MemoryMarshal.GetArrayDataReference(result))
+							Buffer.MemoryCopy(arrayContainer.Data.ToPointer(), destination, byteCount, byteCount);
+					}
+				}
+				else
 				{
-					IntPtr source = (IntPtr)(((byte*)arrayContainer.Data.ToPointer()) + (i * elementSize));
-					result.SetValue(Marshal.PtrToStructure(source, InElementType), i);
+					for (int i = 0; i < arrayContainer.Length; i++)
+					{
+						IntPtr source = (IntPtr)(((byte*)arrayContainer.Data.ToPointer()) + (i * elementSize));
+						result.SetValue(Marshal.PtrToStructure(source, InElementType), i);
+					}
 				}
 			}
 		}
@@ -149,26 +167,19 @@ public static class Marshalling
 		{
 			var arrayContainer = MarshalPointer<ObjectArrayContainer>(InArray);
 
-			if (ArrayStorage.HasFieldArray(null, null))
-			{
-				var fieldArray = ArrayStorage.GetFieldArray(null, null, null);
+			result = Array.CreateInstance(InElementType, arrayContainer.Length);
 
-				if (arrayContainer.Data == fieldArray!.Value.AddrOfPinnedObject())
-				{
-					return fieldArray.Value.Target;
-				}
-			}
+			// Arrays of reference types are covariant, storing into object[] avoids Array.SetValue
+			var objects = (object?[])result;
 
-			result = Array.CreateInstance(InElementType, arrayContainer.Length);
-			
 			unsafe
 			{
-				for (int i = 0; i < arrayContainer.Length; i++)
+				var elements = (ArrayObject*)arrayContainer.Data;
+
+				for (int i = 0; i < objects.Length; i++)
 				{
-					IntPtr source = (IntPtr)(((byte*)arrayContainer.Data.ToPointer()) + (i * Marshal.SizeOf<ArrayObject>()));
-					var managedObject = MarshalPointer<ArrayObject>(source);
-					var target = GCHandle.FromIntPtr(managedObject.Handle).Target;
-					result.SetValue(target, i);
+					var handle = elements[i].Handle;
+					objects[i] = handle != IntPtr.Zero ? GCHandle.FromIntPtr(handle).Target : null;
 				}
 			}
 		}
@@ -229,7 +240,7 @@ public static class Marshalling
 		if (InType == typeof(string))
 		{
 			var nativeString = Marshal.PtrToStructure<NativeString>(InValue);
-			return nativeString.ToString();
+			return StringInterning.Decode(nativeString.m_NativeString);
 		}
 		else if (InType == typeof(NativeString))
 		{
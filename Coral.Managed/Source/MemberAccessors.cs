@@ -0,0 +1,157 @@
+using System;
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Reflection.Emit;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+internal delegate void MemberGetter(object? InTarget, IntPtr OutValue);
+internal delegate void MemberSetter(object? InTarget, IntPtr InValue);
+
+// Compiled getters and setters for fields and properties, they copy the value between the member and native
+// memory directly instead of going through FieldInfo.GetValue / SetValue and boxing.
+internal static class MemberAccessors
+{
+	private static readonly ConcurrentDictionary<MemberInfo, MemberGetter?> s_Getters = new();
+	private static readonly ConcurrentDictionary<MemberInfo, MemberSetter?> s_Setters = new();
+
+	private static readonly Type[] s_AccessorParameterTypes = [typeof(object), typeof(IntPtr)];
+
+	// Both return null if the member can't be compiled, in which case the caller should fall back to reflection.
+	internal static MemberGetter? GetGetter(MemberInfo InMemberInfo)
+	{
+		if (!MethodInvokers.IsEnabled)
+			return null;
+
+		return s_Getters.GetOrAdd(InMemberInfo, static memberInfo => Compile(memberInfo, CompileGetter));
+	}
+
+	internal static MemberSetter? GetSetter(MemberInfo InMemberInfo)
+	{
+		if (!MethodInvokers.IsEnabled)
+			return null;
+
+		return s_Setters.GetOrAdd(InMemberInfo, static memberInfo => Compile(memberInfo, CompileSetter));
+	}
+
+	private static T? Compile<T>(MemberInfo InMemberInfo, Func<MemberInfo, T?> InCompiler) where T : Delegate
+	{
+		try
+		{
+			return InCompiler(InMemberInfo);
+		}
+		catch (Exception ex)
+		{
+			LogMessage($"Failed to compile accessor for '{InMemberInfo.DeclaringType?.FullName}.{InMemberInfo.Name}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+			return null;
+		}
+	}
+
+	private static bool TryGetAccessInfo(MemberInfo InMemberInfo, bool InIsSetter, out Type OutValueType, out bool OutIsStatic)
+	{
+		OutValueType = typeof(void);
+		OutIsStatic = false;
+
+		if (InMemberInfo.DeclaringType == null || InMemberInfo.DeclaringType.ContainsGenericParameters)
+			return false;
+
+		if (InMemberInfo is FieldInfo fieldInfo)
+		{
+			if (fieldInfo.IsLiteral || (InIsSetter && fieldInfo.IsStatic && fieldInfo.IsInitOnly))
+				return false;
+
+			OutValueType = fieldInfo.FieldType;
+			OutIsStatic = fieldInfo.IsStatic;
+			return true;
+		}
+
+		if (InMemberInfo is PropertyInfo propertyInfo)
+		{
+			var accessor = InIsSetter ? propertyInfo.SetMethod : propertyInfo.GetMethod;
+
+			if (accessor == null || propertyInfo.GetIndexParameters().Length > 0)
+				return false;
+
+			OutValueType = propertyInfo.PropertyType;
+			OutIsStatic = accessor.IsStatic;
+			return true;
+		}
+
+		return false;
+	}
+
+	private static void EmitLoadTarget(ILGenerator InIL, Type InDeclaringType)
+	{
+		InIL.Emit(OpCodes.Ldarg_0);
+
+		// Structs are modified in place inside their box, same as FieldInfo.SetValue does
+		InIL.Emit(InDeclaringType.IsValueType ? OpCodes.Unbox : OpCodes.Castclass, InDeclaringType);
+	}
+
+	private static MemberGetter? CompileGetter(MemberInfo InMemberInfo)
+	{
+		if (!TryGetAccessInfo(InMemberInfo, false, out var valueType, out bool isStatic) || !MarshalEmitter.CanEmitReturn(valueType))
+			return null;
+
+		var method = new DynamicMethod($"Get_{InMemberInfo.DeclaringType!.Name}_{InMemberInfo.Name}", typeof(void), s_AccessorParameterTypes, restrictedSkipVisibility: true);
+		var il = method.GetILGenerator();
+
+		if (!isStatic)
+			EmitLoadTarget(il, InMemberInfo.DeclaringType);
+
+		if (InMemberInfo is FieldInfo fieldInfo)
+		{
+			il.Emit(isStatic ? OpCodes.Ldsfld : OpCodes.Ldfld, fieldInfo);
+		}
+		else
+		{
+			var getter = ((PropertyInfo)InMemberInfo).GetMethod!;
+			il.Emit(isStatic || InMemberInfo.DeclaringType.IsValueType ? OpCodes.Call : OpCodes.Callvirt, getter);
+		}
+
+		var value = il.DeclareLocal(valueType);
+		il.Emit(OpCodes.Stloc, value);
+		MarshalEmitter.EmitWriteResult(il, valueType, value, 1);
+		il.Emit(OpCodes.Ret);
+
+		return method.CreateDelegate<MemberGetter>();
+	}
+
+	private static MemberSetter? CompileSetter(MemberInfo InMemberInfo)
+	{
+		if (!TryGetAccessInfo(InMemberInfo, true, out var valueType, out bool isStatic) || !MarshalEmitter.CanEmitParameter(valueType))
+			return null;
+
+		var method = new DynamicMethod($"Set_{InMemberInfo.DeclaringType!.Name}_{InMemberInfo.Name}", typeof(void), s_AccessorParameterTypes, restrictedSkipVisibility: true);
+		var il = method.GetILGenerator();
+
+		if (!isStatic)
+			EmitLoadTarget(il, InMemberInfo.DeclaringType);
+
+		il.Emit(OpCodes.Ldarg_1);
+
+		if (InMemberInfo is FieldInfo fieldInfo)
+		{
+			MarshalEmitter.EmitReadField(il, valueType);
+			il.Emit(isStatic ? OpCodes.Stsfld : OpCodes.Stfld, fieldInfo);
+		}
+		else
+		{
+			var setter = ((PropertyInfo)InMemberInfo).SetMethod!;
+			MarshalEmitter.EmitReadParameter(il, valueType);
+			il.Emit(isStatic || InMemberInfo.DeclaringType.IsValueType ? OpCodes.Call : OpCodes.Callvirt, setter);
+		}
+
+		il.Emit(OpCodes.Ret);
+
+		return method.CreateDelegate<MemberSetter>();
+	}
+
+	internal static void Clear()
+	{
+		s_Getters.Clear();
+		s_Setters.Clear();
+	}
+}
@@ -0,0 +1,128 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Reflection;
+
+namespace Coral.Managed;
+
+// The methods of a type and all of its base types grouped by name and parameter count. Resolving an overload is a single
+// lookup followed by comparing the signatures of the few methods that share the name and parameter count.
+internal sealed class MethodIndex<T> where T : MethodBase
+{
+	private readonly struct Candidate
+	{
+		public readonly T Method;
+		public readonly ManagedType[] ParameterTypes;
+
+		public Candidate(T InMethod, ManagedType[] InParameterTypes)
+		{
+			Method = InMethod;
+			ParameterTypes = InParameterTypes;
+		}
+	}
+
+	private readonly Dictionary<(string Name, int ParameterCount), Candidate[]> m_Candidates = new();
+
+	// Every method in lookup order, only used when the name is a full signature
+	private readonly T[] m_Methods;
+
+	public MethodIndex(T[] InMethods)
+	{
+		m_Methods = InMethods;
+
+		var candidates = new Dictionary<(string, int), List<Candidate>>();
+
+		foreach (var method in InMethods)
+		{
+			var parameters = method.GetParameters();
+			var parameterTypes = new ManagedType[parameters.Length];
+
+			for (int i = 0; i < parameters.Length; i++)
+				parameterTypes[i] = TypeInterface.GetManagedType(parameters[i].ParameterType);
+
+			var key = (method.Name, parameters.Length);
+
+			if (!candidates.TryGetValue(key, out var list))
+			{
+				list = new List<Candidate>();
+				candidates.Add(key, list);
+			}
+
+			list.Add(new Candidate(method, parameterTypes));
+		}
+
+		foreach (var (key, list) in candidates)
+			m_Candidates.Add(key, list.ToArray());
+	}
+
+	// Matches TypeInterface.FindSuitableMethod, the first method (most derived type first) with a matching signature wins
+	public unsafe T? Find(string? InName, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		if (InName == null)
+			return null;
+
+		if (m_Candidates.TryGetValue((InName, InParameterCount), out var candidates))
+		{
+			foreach (var candidate in candidates)
+			{
+				if (new ReadOnlySpan<ManagedType>(InParameterTypes, InParameterCount).SequenceEqual(candidate.ParameterTypes))
+					return candidate.Method;
+			}
+		}
+
+		// Method names can also be passed as the full signature returned by MethodInfo.ToString(), e.g "Int32 IntTest(Int32)"
+		if (InName.Contains('('))
+			return TypeInterface.FindSuitableMethod<T>(InName, InParameterTypes, InParameterCount, m_Methods);
+
+		return null;
+	}
+}
+
+internal static class MethodIndices
+{
+	private static readonly ConcurrentDictionary<(Type, BindingFlags), MethodIndex<MethodInfo>> s_Methods = new();
+	private static readonly ConcurrentDictionary<Type, MethodIndex<ConstructorInfo>> s_Constructors = new();
+
+	// MethodBase.GetParameters copies the parameter array on every call
+	private static readonly ConcurrentDictionary<MethodBase, int> s_ParameterCounts = new();
+
+	// Built on first use, the index covers the type and all of its base types
+	internal static MethodIndex<MethodInfo> GetMethods(Type InType, BindingFlags InBindingFlags)
+	{
+		return s_Methods.GetOrAdd((InType, InBindingFlags), static key =>
+		{
+			var (type, bindingFlags) = key;
+			var methods = new List<MethodInfo>(type.GetMethods(bindingFlags));
+
+			for (var baseType = type.BaseType; baseType != null; baseType = baseType.BaseType)
+				methods.AddRange(baseType.GetMethods(bindingFlags));
+
+			return new MethodIndex<MethodInfo>(methods.ToArray());
+		});
+	}
+
+	internal static MethodIndex<ConstructorInfo> GetConstructors(Type InType)
+	{
+		return s_Constructors.GetOrAdd(InType, static type =>
+		{
+			var constructors = new List<ConstructorInfo>();
+
+			for (var currentType = type; currentType != null; currentType = currentType.BaseType)
+				constructors.AddRange(currentType.GetConstructors(BindingFlags.NonPublic | BindingFlags.Public | BindingFlags.Instance));
+
+			return new MethodIndex<ConstructorInfo>(constructors.ToArray());
+		});
+	}
+
+	internal static int GetParameterCount(MethodBase InMethod)
+	{
+		return s_ParameterCounts.GetOrAdd(InMethod, static method => method.GetParameters().Length);
+	}
+
+	internal static void Clear()
+	{
+		s_Methods.Clear();
+		s_Constructors.Clear();
+		s_ParameterCounts.Clear();
+	}
+}
@@ -0,0 +1,127 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+internal delegate void MethodInvoker(object? InTarget, IntPtr InParameters, IntPtr InResultStorage);
+
+// Compiles a stub per method that reads the arguments straight out of the native `const void**` block
+// and writes the result to the native result storage, replacing MethodInfo.Invoke and the boxing done by
+// Marshalling.MarshalParameterArray / Marshalling.MarshalReturnValue.
+internal static class MethodInvokers
+{
+	private static readonly ConcurrentDictionary<MethodInfo, MethodInvoker?> s_Invokers = new();
+	private static readonly Type[] s_InvokerParameterTypes = [typeof(object), typeof(IntPtr), typeof(IntPtr)];
+
+	private static bool s_Enabled = RuntimeFeature.IsDynamicCodeCompiled;
+
+	internal static bool IsEnabled => s_Enabled;
+
+	// Returns null if compiled invokers are disabled or the method can't be compiled, in which case
+	// the caller should fall back to reflection.
+	internal static MethodInvoker? Get(MethodInfo InMethodInfo)
+	{
+		if (!s_Enabled)
+			return null;
+
+		return s_Invokers.GetOrAdd(InMethodInfo, static methodInfo =>
+		{
+			try
+			{
+				return Compile(methodInfo);
+			}
+			catch (Exception ex)
+			{
+				LogMessage($"Failed to compile invoker for method '{methodInfo}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+				return null;
+			}
+		});
+	}
+
+	private static MethodInvoker? Compile(MethodInfo InMethodInfo)
+	{
+		if (InMethodInfo.ContainsGenericParameters || InMethodInfo.DeclaringType == null)
+			return null;
+
+		if (!InMethodInfo.IsStatic && InMethodInfo.DeclaringType.IsValueType)
+			return null;
+
+		if (!MarshalEmitter.CanEmitReturn(InMethodInfo.ReturnType))
+			return null;
+
+		var parameters = InMethodInfo.GetParameters();
+
+		foreach (var parameter in parameters)
+		{
+			if (!MarshalEmitter.CanEmitParameter(parameter.ParameterType))
+				return null;
+		}
+
+		var method = new DynamicMethod($"Invoke_{InMethodInfo.DeclaringType.Name}_{InMethodInfo.Name}", typeof(void), s_InvokerParameterTypes, restrictedSkipVisibility: true);
+		var il = method.GetILGenerator();
+
+		if (!InMethodInfo.IsStatic)
+		{
+			il.Emit(OpCodes.Ldarg_0);
+			il.Emit(OpCodes.Castclass, InMethodInfo.DeclaringType);
+		}
+
+		for (int i = 0; i < parameters.Length; i++)
+		{
+			il.Emit(OpCodes.Ldarg_1);
+
+			if (i > 0)
+			{
+				il.Emit(OpCodes.Ldc_I4, i * IntPtr.Size);
+				il.Emit(OpCodes.Add);
+			}
+
+			il.Emit(OpCodes.Ldind_I);
+			MarshalEmitter.EmitReadParameter(il, parameters[i].ParameterType);
+		}
+
+		il.Emit(InMethodInfo.IsStatic ? OpCodes.Call : OpCodes.Callvirt, InMethodInfo);
+
+		if (InMethodInfo.ReturnType != typeof(void))
+		{
+			var result = il.DeclareLocal(InMethodInfo.ReturnType);
+			var endLabel = il.DefineLabel();
+
+			il.Emit(OpCodes.Stloc, result);
+			il.Emit(OpCodes.Ldarg_2);
+			il.Emit(OpCodes.Brfalse, endLabel);
+			MarshalEmitter.EmitWriteResult(il, InMethodInfo.ReturnType, result, 2);
+			il.MarkLabel(endLabel);
+		}
+
+		il.Emit(OpCodes.Ret);
+
+		return method.CreateDelegate<MethodInvoker>();
+	}
+
+	internal static void Clear()
+	{
+		s_Invokers.Clear();
+		MarshalEmitter.Clear();
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetCompiledInvokersEnabled(Bool32 InEnabled)
+	{
+		if (InEnabled && !RuntimeFeature.IsDynamicCodeCompiled)
+		{
+			LogMessage("Compiled invokers can't be enabled, dynamic code isn't compiled on this runtime.", MessageLevel.Warning);
+			return;
+		}
+
+		s_Enabled = InEnabled;
+	}
+}
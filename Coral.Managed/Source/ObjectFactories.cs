@@ -0,0 +1,276 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+internal delegate object ObjectFactory(IntPtr InParameters);
+
+internal sealed class ObjectConstructor
+{
+	public readonly Type Type;
+	public readonly ConstructorInfo Constructor;
+	public readonly int ParameterCount;
+
+	// Null if the constructor couldn't be compiled, the object is then created through reflection
+	public readonly ObjectFactory? Factory;
+
+	public ObjectConstructor(Type InType, ConstructorInfo InConstructor, ObjectFactory? InFactory)
+	{
+		Type = InType;
+		Constructor = InConstructor;
+		ParameterCount = InConstructor.GetParameters().Length;
+		Factory = InFactory;
+	}
+}
+
+// Compiled `newobj` stubs per constructor, they read the arguments out of the native `const void**` block
+// the same way MethodInvokers does and replace Assembly.CreateInstance, which looks the type up by name again.
+internal static class ObjectFactories
+{
+	private static readonly ConcurrentDictionary<(Type, ConstructorInfo), ObjectConstructor> s_Constructors = new();
+	private static readonly UniqueIdList<ObjectConstructor> s_ResolvedConstructors = new();
+
+	private static readonly Type[] s_FactoryParameterTypes = [typeof(IntPtr)];
+
+	internal static ObjectConstructor Get(Type InType, ConstructorInfo InConstructor)
+	{
+		return s_Constructors.GetOrAdd((InType, InConstructor), static key =>
+		{
+			var (type, constructor) = key;
+			ObjectFactory? factory = null;
+
+			if (MethodInvokers.IsEnabled)
+			{
+				try
+				{
+					factory = Compile(type, constructor);
+				}
+				catch (Exception ex)
+				{
+					LogMessage($"Failed to compile factory for constructor '{constructor}' of type '{type.FullName}', falling back to reflection. {ex.Message}", MessageLevel.Warning);
+				}
+			}
+
+			return new ObjectConstructor(type, constructor, factory);
+		});
+	}
+
+	private static ObjectFactory? Compile(Type InType, ConstructorInfo InConstructor)
+	{
+		// Constructors found on a base type have to run on an instance of the derived type, which `newobj` can't do
+		if (InConstructor.DeclaringType != InType || InType.IsAbstract || InType.ContainsGenericParameters)
+			return null;
+
+		var parameters = InConstructor.GetParameters();
+
+		foreach (var parameter in parameters)
+		{
+			if (!MarshalEmitter.CanEmitParameter(parameter.ParameterType))
+				return null;
+		}
+
+		var method = new DynamicMethod($"New_{InType.Name}", typeof(object), s_FactoryParameterTypes, restrictedSkipVisibility: true);
+		var il = method.GetILGenerator();
+
+		for (int i = 0; i < parameters.Length; i++)
+		{
+			il.Emit(OpCodes.Ldarg_0);
+
+			if (i > 0)
+			{
+				il.Emit(OpCodes.Ldc_I4, i * IntPtr.Size);
+				il.Emit(OpCodes.Add);
+			}
+
+			il.Emit(OpCodes.Ldind_I);
+			MarshalEmitter.EmitReadParameter(il, parameters[i].ParameterType);
+		}
+
+		il.Emit(OpCodes.Newobj, InConstructor);
+
+		if (InType.IsValueType)
+			il.Emit(OpCodes.Box, InType);
+
+		il.Emit(OpCodes.Ret);
+
+		return method.CreateDelegate<ObjectFactory>();
+	}
+
+	internal static object? Instantiate(ObjectConstructor InConstructor, IntPtr InParameters, int InParameterCount)
+	{
+		if (InConstructor.Factory != null && MethodInvokers.IsEnabled)
+			return InConstructor.Factory(InParameters);
+
+		var parameters = Marshalling.MarshalParameterArray(InParameters, InParameterCount, InConstructor.Constructor);
+
+		// The constructor may have been found on a base type
+		if (InConstructor.Constructor.DeclaringType != InConstructor.Type)
+		{
+			var result = TypeInterface.CreateInstance(InConstructor.Type);
+
+			if (result != null)
+				InConstructor.Constructor.Invoke(result, parameters);
+
+			return result;
+		}
+
+		return InConstructor.Constructor.Invoke(parameters);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe int ResolveConstructor(int InType, ManagedType* InParameterTypes, int InParameterCount)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type == null)
+			{
+				LogMessage("Cannot resolve a constructor on a null type.", MessageLevel.Error);
+				return -1;
+			}
+
+			var constructor = MethodIndices.GetConstructors(type).Find(".ctor", InParameterTypes, InParameterCount);
+
+			if (constructor == null)
+			{
+				LogMessage($"Failed to find constructor for type {type.FullName} with {InParameterCount} parameters.", MessageLevel.Error);
+				return -1;
+			}
+
+			return s_ResolvedConstructors.Add(Get(type, constructor));
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return -1;
+		}
+	}
+
+	// InType is the type native code creates the objects as, the handle has to have been resolved on that type
+	private static ObjectConstructor? GetResolvedConstructor(int InType, int InConstructor, int InParameterCount)
+	{
+		if (!s_ResolvedConstructors.TryGetValue(InConstructor, out var constructor) || constructor == null)
+		{
+			LogMessage($"Failed to find constructor with handle '{InConstructor}'.", MessageLevel.Error);
+			return null;
+		}
+
+		if (!TypeInterface.s_CachedTypes.TryGetValue(InType, out var type) || type != constructor.Type)
+		{
+			LogMessage($"Constructor with handle '{InConstructor}' creates objects of type '{constructor.Type.FullName}', not '{type?.FullName ?? "NULL"}'.", MessageLevel.Error);
+			return null;
+		}
+
+		if (constructor.ParameterCount != InParameterCount)
+		{
+			LogMessage($"Constructor of type '{constructor.Type.FullName}' expects {constructor.ParameterCount} parameters but {InParameterCount} were passed.", MessageLevel.Error);
+			return null;
+		}
+
+		return constructor;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr CreateObjectWithConstructor(int InType, int InConstructor, Bool32 InWeakRef, IntPtr InParameters, int InParameterCount)
+	{
+		try
+		{
+			var constructor = GetResolvedConstructor(InType, InConstructor, InParameterCount);
+
+			if (constructor == null)
+				return IntPtr.Zero;
+
+			var pool = InParameterCount == 0 && !InWeakRef ? ObjectPools.Find(constructor.Type) : null;
+
+			if (pool != null && pool.TryRent(out var pooledHandle))
+				return pooledHandle;
+
+			var result = Instantiate(constructor, InParameters, InParameterCount);
+
+			if (result == null)
+			{
+				LogMessage($"Failed to instantiate type {constructor.Type.FullName}.", MessageLevel.Error);
+				return IntPtr.Zero;
+			}
+
+			return pool != null ? pool.Adopt(result) : ManagedObject.AllocateHandle(result, InWeakRef);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	// Writes the handle of object i to OutHandles + i * InHandleStride, or null if it couldn't be created. InParameterStride is in bytes,
+	// a stride of 0 constructs every object with the same arguments.
+	[UnmanagedCallersOnly]
+	internal static unsafe int CreateObjects(int InType, int InConstructor, IntPtr OutHandles, int InHandleStride, int InCount, IntPtr InParameters, int InParameterCount, int InParameterStride)
+	{
+		int createdCount = 0;
+
+		for (int i = 0; i < InCount; i++)
+			*(IntPtr*)(OutHandles + (nint)i * InHandleStride) = IntPtr.Zero;
+
+		try
+		{
+			var constructor = GetResolvedConstructor(InType, InConstructor, InParameterCount);
+
+			if (constructor == null)
+				return 0;
+
+			var pool = InParameterCount == 0 ? ObjectPools.Find(constructor.Type) : null;
+
+			for (int i = 0; i < InCount; i++)
+			{
+				// Each object is isolated, an exception only fails that object
+				try
+				{
+					if (pool != null && pool.TryRent(out var pooledHandle))
+					{
+						*(IntPtr*)(OutHandles + (nint)i * InHandleStride) = pooledHandle;
+						createdCount++;
+						continue;
+					}
+
+					var result = Instantiate(constructor, InParameters + (nint)i * InParameterStride, InParameterCount);
+
+					if (result == null)
+					{
+						LogMessage($"Failed to instantiate type {constructor.Type.FullName}.", MessageLevel.Error);
+						continue;
+					}
+
+					*(IntPtr*)(OutHandles + (nint)i * InHandleStride) = pool != null ? pool.Adopt(result) : ManagedObject.AllocateHandle(result, false);
+					createdCount++;
+				}
+				catch (TargetInvocationException ex)
+				{
+					HandleException(ex.InnerException ?? ex);
+				}
+				catch (Exception ex)
+				{
+					HandleException(ex);
+				}
+			}
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+
+		return createdCount;
+	}
+
+	internal static void Clear()
+	{
+		s_Constructors.Clear();
+		s_ResolvedConstructors.Clear();
+	}
+}
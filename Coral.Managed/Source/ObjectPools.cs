@@ -0,0 +1,272 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using System.Threading;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Implemented by pooled types that need to clear their state before being handed out again
+public interface IPoolable
+{
+	void Reset();
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct PoolStats
+{
+	public long Hits;
+	public long Misses;
+	public int PooledCount;
+}
+
+internal sealed class ObjectPool
+{
+	public readonly int Capacity;
+	public long Hits;
+	public long Misses;
+
+	// Pooled objects keep the strong handle they were created with
+	private readonly Stack<IntPtr> m_Available = new();
+
+	// Every handle created by the pool, pooled or in use. Other handles to the same objects (copies, weak handles) are never pooled.
+	private readonly HashSet<IntPtr> m_Owned = new();
+
+	// Objects that are being reset, they already count towards the capacity
+	private int m_ReturningCount = 0;
+
+	private readonly object m_Lock = new();
+
+	public ObjectPool(int InCapacity)
+	{
+		Capacity = InCapacity;
+	}
+
+	public bool TryRent(out IntPtr OutHandle)
+	{
+		lock (m_Lock)
+		{
+			if (!m_Available.TryPop(out OutHandle))
+			{
+				Misses++;
+				return false;
+			}
+
+			Hits++;
+		}
+
+		if (!IdentityMap.IsEnabled)
+			return true;
+
+		// Something else may have shared a handle to the object while it was pooled, in which case that one is used from now on
+		var handle = GCHandle.FromIntPtr(OutHandle);
+		var sharedHandle = IdentityMap.Adopt(handle.Target!, OutHandle);
+
+		if (sharedHandle != OutHandle)
+		{
+			lock (m_Lock)
+				m_Owned.Remove(OutHandle);
+
+			HandleRegistry.Deregister(handle);
+			handle.Free();
+			OutHandle = sharedHandle;
+		}
+
+		return true;
+	}
+
+	public IntPtr Adopt(object InObject)
+	{
+		var handlePtr = ManagedObject.AllocateHandle(InObject, false);
+
+		lock (m_Lock)
+			m_Owned.Add(handlePtr);
+
+		return handlePtr;
+	}
+
+	// Returns false if the handle has to be freed by the caller
+	public bool Return(IntPtr InHandle, object InTarget)
+	{
+		lock (m_Lock)
+		{
+			if (!m_Owned.Contains(InHandle))
+				return false;
+
+			// A handle shared through the identity map is still in use
+			if (m_Available.Count + m_ReturningCount >= Capacity || IdentityMap.Contains(InTarget))
+			{
+				m_Owned.Remove(InHandle);
+				return false;
+			}
+
+			m_ReturningCount++;
+		}
+
+		bool reset = true;
+
+		try
+		{
+			// Nothing attached to the previous use of the object may be visible to the next one
+			UserData.Clear(InTarget);
+			ObjectTable.Remove(InTarget);
+
+			if (InTarget is IPoolable poolable)
+				poolable.Reset();
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			reset = false;
+		}
+
+		lock (m_Lock)
+		{
+			m_ReturningCount--;
+
+			// The pool may have been cleared while the object was being reset
+			if (!reset || !m_Owned.Contains(InHandle))
+			{
+				m_Owned.Remove(InHandle);
+				return false;
+			}
+
+			m_Available.Push(InHandle);
+			return true;
+		}
+	}
+
+	public PoolStats GetStats()
+	{
+		lock (m_Lock)
+			return new PoolStats { Hits = Hits, Misses = Misses, PooledCount = m_Available.Count };
+	}
+
+	// The handles that are still in use are freed normally once native code destroys them
+	public void Clear()
+	{
+		lock (m_Lock)
+		{
+			foreach (var handlePtr in m_Available)
+			{
+				var handle = GCHandle.FromIntPtr(handlePtr);
+				HandleRegistry.Deregister(handle);
+				handle.Free();
+			}
+
+			m_Available.Clear();
+			m_Owned.Clear();
+		}
+	}
+}
+
+// Per type pools enabled by the host, parameterless creation reuses a destroyed instance instead of allocating a new one
+internal static class ObjectPools
+{
+	private static readonly ConcurrentDictionary<Type, ObjectPool> s_Pools = new();
+
+	// Keeps FreeHandle from looking up the target's type when no type is pooled
+	private static int s_PoolCount = 0;
+
+	internal static ObjectPool? Find(Type InType)
+	{
+		if (Volatile.Read(ref s_PoolCount) == 0)
+			return null;
+
+		return s_Pools.TryGetValue(InType, out var pool) ? pool : null;
+	}
+
+	internal static bool Return(GCHandle InHandle)
+	{
+		if (Volatile.Read(ref s_PoolCount) == 0)
+			return false;
+
+		var target = InHandle.Target;
+
+		if (target == null || !s_Pools.TryGetValue(target.GetType(), out var pool))
+			return false;
+
+		return pool.Return(GCHandle.ToIntPtr(InHandle), target);
+	}
+
+	private static void Remove(Type InType)
+	{
+		if (!s_Pools.TryRemove(InType, out var pool))
+			return;
+
+		Interlocked.Decrement(ref s_PoolCount);
+		pool.Clear();
+	}
+
+	internal static void Release(AssemblyLoadContext InContext)
+	{
+		foreach (var type in s_Pools.Keys)
+		{
+			if (AssemblyLoadContext.GetLoadContext(type.Assembly) == InContext)
+				Remove(type);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void EnablePooling(int InTypeID, int InCapacity)
+	{
+		try
+		{
+			if (!TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type) || type == null)
+			{
+				LogMessage($"Failed to find type with id '{InTypeID}'.", MessageLevel.Error);
+				return;
+			}
+
+			if (type.IsValueType || type.IsAbstract)
+			{
+				LogMessage($"Cannot pool instances of type '{type.FullName}'. Only concrete reference types can be pooled.", MessageLevel.Error);
+				return;
+			}
+
+			Remove(type);
+
+			if (s_Pools.TryAdd(type, new ObjectPool(InCapacity)))
+				Interlocked.Increment(ref s_PoolCount);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void DisablePooling(int InTypeID)
+	{
+		try
+		{
+			if (TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type) && type != null)
+				Remove(type);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe void GetPoolStats(int InTypeID, PoolStats* OutStats)
+	{
+		*OutStats = default;
+
+		try
+		{
+			if (TypeInterface.s_CachedTypes.TryGetValue(InTypeID, out var type) && type != null && s_Pools.TryGetValue(type, out var pool))
+				*OutStats = pool.GetStats();
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+}
@@ -0,0 +1,359 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Runtime.Loader;
+using System.Threading;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// Objects referenced from native code through Coral::ManagedObjectRef. A reference is the slot index in the low 32 bits and
+// the slot generation in the high 32 bits, resolving it is an array access instead of GCHandle.FromIntPtr.
+// Generations start at 1 so that 0 is never a valid reference.
+internal static class ObjectTable
+{
+	private struct Slot
+	{
+		public object? Target;
+		public uint Generation;
+		public int NextFree;
+
+		// The native Coral::Type the reference was created with, handed back to native code as is
+		public IntPtr Type;
+	}
+
+	// Slots live in fixed size segments that never move, growing the table only adds segments
+	private const int SegmentShift = 10;
+	private const int SegmentSize = 1 << SegmentShift;
+
+	private static Slot[]?[] s_Segments = new Slot[]?[16];
+	private static int s_SlotCount = 0;
+	private static int s_FreeHead = -1;
+
+	// Only taken when adding or removing, lookups read the slots directly
+	private static readonly object s_Lock = new();
+
+	// References to instances of pooled types, released when the instance goes back to its pool
+	private static readonly ConditionalWeakTable<object, List<ulong>> s_PooledRefs = new();
+
+	private static ref Slot GetSlot(int InIndex) => ref s_Segments[InIndex >> SegmentShift]![InIndex & (SegmentSize - 1)];
+
+	internal static ulong Add(object InTarget, IntPtr InType)
+	{
+		lock (s_Lock)
+		{
+			int index;
+
+			if (s_FreeHead != -1)
+			{
+				index = s_FreeHead;
+				s_FreeHead = GetSlot(index).NextFree;
+			}
+			else
+			{
+				index = s_SlotCount;
+				int segment = index >> SegmentShift;
+
+				if (segment == s_Segments.Length)
+				{
+					var segments = s_Segments;
+					Array.Resize(ref segments, segments.Length * 2);
+					Volatile.Write(ref s_Segments, segments);
+				}
+
+				if (s_Segments[segment] == null)
+					Volatile.Write(ref s_Segments[segment], new Slot[SegmentSize]);
+
+				GetSlot(index).Generation = 1;
+				s_SlotCount++;
+			}
+
+			// The generation was bumped when the slot was freed, so a reader holding an old reference can't match the new target
+			ref var slot = ref GetSlot(index);
+			slot.Type = InType;
+			Volatile.Write(ref slot.Target, InTarget);
+
+			ulong result = ((ulong)slot.Generation << 32) | (uint)index;
+
+			if (ObjectPools.Find(InTarget.GetType()) != null)
+			{
+				var refs = s_PooledRefs.GetOrCreateValue(InTarget);
+				refs.RemoveAll(static objectRef => !IsLive(objectRef));
+				refs.Add(result);
+			}
+
+			return result;
+		}
+	}
+
+	// Reads the generation on both sides of the target, a slot that was freed or reused in between doesn't match the reference
+	private static bool TryRead(ulong InRef, out object? OutTarget, out IntPtr OutType)
+	{
+		OutTarget = null;
+		OutType = IntPtr.Zero;
+
+		var segments = Volatile.Read(ref s_Segments);
+		uint index = (uint)InRef;
+		uint segment = index >> SegmentShift;
+
+		if (segment >= (uint)segments.Length)
+			return false;
+
+		var slots = Volatile.Read(ref segments[segment]);
+
+		if (slots == null)
+			return false;
+
+		ref var slot = ref slots[index & (SegmentSize - 1)];
+		uint generation = (uint)(InRef >> 32);
+
+		if (Volatile.Read(ref slot.Generation) != generation)
+			return false;
+
+		var target = Volatile.Read(ref slot.Target);
+		var type = Volatile.Read(ref slot.Type);
+
+		if (Volatile.Read(ref slot.Generation) != generation || target == null)
+			return false;
+
+		OutTarget = target;
+		OutType = type;
+		return true;
+	}
+
+	internal static object? Get(ulong InRef)
+	{
+		return TryRead(InRef, out var target, out _) ? target : null;
+	}
+
+	internal static bool Remove(ulong InRef)
+	{
+		lock (s_Lock)
+		{
+			if (!IsLive(InRef))
+				return false;
+
+			FreeSlot((int)(uint)InRef);
+			return true;
+		}
+	}
+
+	// Invalidates every reference to a pooled instance before it's handed out again
+	internal static void Remove(object InTarget)
+	{
+		lock (s_Lock)
+		{
+			if (!s_PooledRefs.TryGetValue(InTarget, out var refs))
+				return;
+
+			foreach (var objectRef in refs)
+			{
+				if (IsLive(objectRef))
+					FreeSlot((int)(uint)objectRef);
+			}
+
+			s_PooledRefs.Remove(InTarget);
+		}
+	}
+
+	// Has to be called with s_Lock held
+	private static bool IsLive(ulong InRef)
+	{
+		uint index = (uint)InRef;
+
+		if (index >= (uint)s_SlotCount)
+			return false;
+
+		ref var slot = ref GetSlot((int)index);
+		return slot.Generation == (uint)(InRef >> 32) && slot.Target != null;
+	}
+
+	private static void FreeSlot(int InIndex)
+	{
+		ref var slot = ref GetSlot(InIndex);
+		Volatile.Write(ref slot.Target, null);
+		Volatile.Write(ref slot.Generation, slot.Generation == uint.MaxValue ? 1 : slot.Generation + 1);
+		slot.Type = IntPtr.Zero;
+		slot.NextFree = s_FreeHead;
+		s_FreeHead = InIndex;
+	}
+
+	// Drops the references to objects from the context so it can be unloaded, native refs to them become invalid
+	internal static void Release(AssemblyLoadContext InContext)
+	{
+		int releasedCount = 0;
+
+		lock (s_Lock)
+		{
+			for (int i = 0; i < s_SlotCount; i++)
+			{
+				var target = GetSlot(i).Target;
+
+				if (target == null || AssemblyLoadContext.GetLoadContext(target.GetType().Assembly) != InContext)
+					continue;
+
+				FreeSlot(i);
+				releasedCount++;
+			}
+		}
+
+		if (releasedCount > 0)
+			LogMessage($"Released {releasedCount} object references that were still in use in AssemblyLoadContext '{InContext.Name}'.", MessageLevel.Warning);
+	}
+
+	private static object? GetTarget(ulong InRef, string InAction)
+	{
+		var target = Get(InRef);
+
+		if (target == null)
+			LogMessage($"Cannot {InAction} object reference {InRef}. It has been released.", MessageLevel.Error);
+
+		return target;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static ulong CreateObjectRef(IntPtr InObjectHandle, IntPtr InType)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+
+			if (target == null)
+			{
+				LogMessage($"Cannot create a reference to object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
+				return 0;
+			}
+
+			return Add(target, InType);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return 0;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void ReleaseObjectRef(ulong InRef)
+	{
+		try
+		{
+			if (!Remove(InRef))
+				LogMessage($"Cannot release object reference {InRef}. It has already been released.", MessageLevel.Warning);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static Bool32 IsObjectRefAlive(ulong InRef)
+	{
+		return Get(InRef) != null;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe IntPtr LockObjectRef(ulong InRef, IntPtr* OutType)
+	{
+		try
+		{
+			*OutType = IntPtr.Zero;
+
+			if (!TryRead(InRef, out var target, out var type))
+				return IntPtr.Zero;
+
+			*OutType = type;
+			return ManagedObject.AllocateHandle(target!, false);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr GetObjectRefType(ulong InRef)
+	{
+		if (TryRead(InRef, out _, out var type))
+			return type;
+
+		LogMessage($"Cannot get the type of object reference {InRef}. It has been released.", MessageLevel.Error);
+		return IntPtr.Zero;
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void InvokeObjectRefMethod(ulong InRef, int InMethodHandle, IntPtr InParameters, int InParameterCount, IntPtr InResultStorage)
+	{
+		try
+		{
+			var target = GetTarget(InRef, $"invoke method with handle {InMethodHandle} on");
+
+			if (target != null)
+				ManagedObject.InvokeResolvedMethod(target, InMethodHandle, InParameters, InParameterCount, InResultStorage);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static unsafe int InvokeMethodBatchRefs(IntPtr InRefs, int InRefCount, int InMethodHandle, IntPtr InParameters, int InParameterCount, int InParameterStride, Bool32* OutResults)
+	{
+		return ManagedObject.InvokeBatch(InRefs, sizeof(ulong), InRefCount, true, InMethodHandle, InParameters, InParameterCount, InParameterStride, OutResults);
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetObjectRefFieldValue(ulong InRef, int InFieldHandle, IntPtr InValue)
+	{
+		try
+		{
+			var target = GetTarget(InRef, $"set value of field with handle {InFieldHandle} on");
+
+			if (target == null)
+				return;
+
+			if (!TypeInterface.s_CachedFields.TryGetValue(InFieldHandle, out var fieldInfo) || fieldInfo == null)
+			{
+				LogMessage($"Failed to find field with handle '{InFieldHandle}'.", MessageLevel.Error);
+				return;
+			}
+
+			ManagedObject.SetFieldValueInternal(target, fieldInfo, InValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void GetObjectRefFieldValue(ulong InRef, int InFieldHandle, IntPtr OutValue)
+	{
+		try
+		{
+			var target = GetTarget(InRef, $"get value of field with handle {InFieldHandle} from");
+
+			if (target == null)
+				return;
+
+			if (!TypeInterface.s_CachedFields.TryGetValue(InFieldHandle, out var fieldInfo) || fieldInfo == null)
+			{
+				LogMessage($"Failed to find field with handle '{InFieldHandle}'.", MessageLevel.Error);
+				return;
+			}
+
+			ManagedObject.GetFieldValueInternal(target, fieldInfo, OutValue);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+}
@@ -0,0 +1,88 @@
+using System;
+using System.Collections.Concurrent;
+using System.Text;
+using System.Threading;
+
+namespace Coral.Managed;
+
+// Maps native strings to System.String by the hash of their characters, the characters are compared against the cached
+// entry so a hash collision never returns the wrong string. Stops growing once it holds Capacity strings, strings that
+// don't fit are decoded every time.
+internal sealed class StringCache
+{
+	private sealed class Entry
+	{
+		// Only set for strings added as UTF-8, UTF-16 characters are compared against Value directly
+		public readonly byte[]? Utf8;
+		public readonly string Value;
+
+		public Entry(byte[]? InUtf8, string InValue)
+		{
+			Utf8 = InUtf8;
+			Value = InValue;
+		}
+	}
+
+	private readonly ConcurrentDictionary<ulong, Entry> m_Entries = new();
+	private int m_Count = 0;
+	private long m_Hits = 0;
+	private long m_Misses = 0;
+
+	public readonly int Capacity;
+
+	public int Count => Volatile.Read(ref m_Count);
+	public long Hits => Interlocked.Read(ref m_Hits);
+	public long Misses => Interlocked.Read(ref m_Misses);
+
+	public StringCache(int InCapacity)
+	{
+		Capacity = InCapacity;
+	}
+
+	public string Get(ulong InHash, ReadOnlySpan<byte> InUtf8)
+	{
+		if (m_Entries.TryGetValue(InHash, out var entry) && entry.Utf8 != null && InUtf8.SequenceEqual(entry.Utf8))
+			return Hit(entry);
+
+		return Add(InHash, InUtf8.ToArray(), Encoding.UTF8.GetString(InUtf8));
+	}
+
+	public string Get(ulong InHash, ReadOnlySpan<char> InChars)
+	{
+		if (m_Entries.TryGetValue(InHash, out var entry) && InChars.SequenceEqual(entry.Value))
+			return Hit(entry);
+
+		return Add(InHash, null, new string(InChars));
+	}
+
+	public void Clear()
+	{
+		m_Entries.Clear();
+		Volatile.Write(ref m_Count, 0);
+		Interlocked.Exchange(ref m_Hits, 0);
+		Interlocked.Exchange(ref m_Misses, 0);
+	}
+
+	private string Hit(Entry InEntry)
+	{
+		Interlocked.Increment(ref m_Hits);
+		return InEntry.Value;
+	}
+
+	private string Add(ulong InHash, byte[]? InUtf8, string InValue)
+	{
+		Interlocked.Increment(ref m_Misses);
+
+		if (Interlocked.Increment(ref m_Count) > Capacity)
+		{
+			Interlocked.Decrement(ref m_Count);
+			return InValue;
+		}
+
+		// On a hash collision the first string stays cached and the other one is decoded every time
+		if (!m_Entries.TryAdd(InHash, new Entry(InUtf8, InValue)))
+			Interlocked.Decrement(ref m_Count);
+
+		return InValue;
+	}
+}
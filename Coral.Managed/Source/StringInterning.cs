@@ -0,0 +1,81 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+[StructLayout(LayoutKind.Sequential)]
+internal struct StringInterningStats
+{
+	public long Hits;
+	public long Misses;
+	public int Count;
+}
+
+// Opt-in cache for string parameters and fields passed from native code, passing the same text again returns the same
+// System.String without allocating.
+internal static unsafe class StringInterning
+{
+	// Changing the settings swaps in a new cache, so a conversion running at the same time keeps using the old one
+	private static StringCache? s_Cache = null;
+
+	// Matches Marshal.PtrToStringAuto, native strings are UTF-16 on Windows and UTF-8 everywhere else.
+	// Only used for string parameters and fields, not every NativeString -> string conversion.
+	internal static string? Decode(IntPtr InString)
+	{
+		var cache = Volatile.Read(ref s_Cache);
+
+		if (cache == null || InString == IntPtr.Zero)
+			return Marshal.PtrToStringAuto(InString);
+
+		if (OperatingSystem.IsWindows())
+		{
+			var chars = MemoryMarshal.CreateReadOnlySpanFromNullTerminated((char*)InString);
+			return cache.Get((ulong)string.GetHashCode(chars), chars);
+		}
+		else
+		{
+			var utf8 = MemoryMarshal.CreateReadOnlySpanFromNullTerminated((byte*)InString);
+
+			var hashCode = new HashCode();
+			hashCode.AddBytes(utf8);
+			return cache.Get((ulong)hashCode.ToHashCode(), utf8);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetStringInterningEnabled(Bool32 InEnabled, int InCapacity)
+	{
+		try
+		{
+			Interlocked.Exchange(ref s_Cache, InEnabled ? new StringCache(InCapacity) : null);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void GetStringInterningStats(StringInterningStats* OutStats)
+	{
+		var cache = Volatile.Read(ref s_Cache);
+
+		if (cache == null)
+		{
+			*OutStats = default;
+			return;
+		}
+
+		*OutStats = new StringInterningStats
+		{
+			Hits = cache.Hits,
+			Misses = cache.Misses,
+			Count = cache.Count
+		};
+	}
+}
@@ -61,8 +61,17 @@ internal static class TypeInterface
 		{ typeof(bool), ManagedType.Bool },
 		{ typeof(NativeString), ManagedType.String },
 		{ typeof(string), ManagedType.String },
+		{ typeof(NativeStringView), ManagedType.StringView },
 	};
 
+	internal static ManagedType GetManagedType(Type InType)
+	{
+		if (InType.IsPointer || InType == typeof(IntPtr))
+			return ManagedType.Pointer;
+
+		return s_TypeConverters.TryGetValue(InType, out var managedType) ? managedType : ManagedType.Unknown;
+	}
+
 	internal static unsafe T? FindSuitableMethod<T>(string? InMethodName, ManagedType* InParameterTypes, int InParameterCount, ReadOnlySpan<T> InMethods) where T : MethodBase
 	{
 		if (InMethodName == null)
@@ -0,0 +1,104 @@
+using Coral.Managed.Interop;
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace Coral.Managed;
+
+using static ManagedHost;
+
+// A native pointer attached to a managed object, looked up by object so every handle to it sees the same value.
+// The entry is finalized together with the object, which is when native code gets the pointer back to free it.
+internal static unsafe class UserData
+{
+	private sealed class Entry
+	{
+		public IntPtr Data;
+		public delegate* unmanaged<IntPtr, void> Deleter;
+
+		~Entry()
+		{
+			Free();
+		}
+
+		public void Free()
+		{
+			if (Data != IntPtr.Zero && Deleter != null)
+				Deleter(Data);
+
+			Data = IntPtr.Zero;
+			Deleter = null;
+		}
+	}
+
+	private static readonly ConditionalWeakTable<object, Entry> s_Entries = new();
+
+	internal static IntPtr Get(object InObject)
+	{
+		return s_Entries.TryGetValue(InObject, out var entry) ? entry.Data : IntPtr.Zero;
+	}
+
+	internal static void Set(object InObject, IntPtr InData, delegate* unmanaged<IntPtr, void> InDeleter)
+	{
+		var entry = s_Entries.GetValue(InObject, static _ => new Entry());
+
+		lock (entry)
+		{
+			// Replacing the pointer frees the previous one, same as resetting a std::unique_ptr
+			if (entry.Data != InData)
+				entry.Free();
+
+			entry.Data = InData;
+			entry.Deleter = InDeleter;
+		}
+	}
+
+	// Frees the pointer now instead of when the object is collected, used when a pooled object is reused
+	internal static void Clear(object InObject)
+	{
+		if (!s_Entries.TryGetValue(InObject, out var entry))
+			return;
+
+		s_Entries.Remove(InObject);
+
+		lock (entry)
+			entry.Free();
+	}
+
+	[UnmanagedCallersOnly]
+	internal static void SetUserData(IntPtr InObjectHandle, IntPtr InData, IntPtr InDeleter)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+
+			if (target == null)
+			{
+				LogMessage($"Cannot set user data of object with handle {InObjectHandle}. Target was null.", MessageLevel.Error);
+				return;
+			}
+
+			Set(target, InData, (delegate* unmanaged<IntPtr, void>)InDeleter);
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+		}
+	}
+
+	[UnmanagedCallersOnly]
+	internal static IntPtr GetUserData(IntPtr InObjectHandle)
+	{
+		try
+		{
+			var target = GCHandle.FromIntPtr(InObjectHandle).Target;
+			return target != null ? Get(target) : IntPtr.Zero;
+		}
+		catch (Exception ex)
+		{
+			HandleException(ex);
+			return IntPtr.Zero;
+		}
+	}
+}
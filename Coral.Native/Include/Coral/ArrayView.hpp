@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	class ArrayPin
+	{
+	public:
+		// Frees the GCHandle that keeps the managed array pinned
+		static void Release(void* InPinHandle);
+	};
+
+	// Zero-copy access to a managed array of blittable elements, returned by GetFieldValue, GetPropertyValue or InvokeMethod.
+	// The array stays pinned for as long as the view exists and writes go straight to the managed array.
+	// Keep views short-lived, pinned arrays can't be moved by the GC.
+	// Array results always have this layout, reading one through the Raw functions into anything else leaks the pin.
+	template<typename TValue>
+	class alignas(8) ArrayView
+	{
+	public:
+		ArrayView() = default;
+
+		ArrayView(ArrayView&& InOther) noexcept
+			: m_Ptr(InOther.m_Ptr), m_PinHandle(InOther.m_PinHandle), m_Length(InOther.m_Length)
+		{
+			InOther.m_Ptr = nullptr;
+			InOther.m_PinHandle = nullptr;
+			InOther.m_Length = 0;
+		}
+
+		ArrayView& operator=(ArrayView&& InOther) noexcept
+		{
+			if (this != &InOther)
+			{
+				Release();
+
+				m_Ptr = InOther.m_Ptr;
+				m_PinHandle = InOther.m_PinHandle;
+				m_Length = InOther.m_Length;
+
+				InOther.m_Ptr = nullptr;
+				InOther.m_PinHandle = nullptr;
+				InOther.m_Length = 0;
+			}
+
+			return *this;
+		}
+
+		ArrayView(const ArrayView&) = delete;
+		ArrayView& operator=(const ArrayView&) = delete;
+
+		~ArrayView()
+		{
+			Release();
+		}
+
+		// Unpins the array, the view is empty afterwards
+		void Release()
+		{
+			if (m_PinHandle)
+				ArrayPin::Release(m_PinHandle);
+
+			m_Ptr = nullptr;
+			m_PinHandle = nullptr;
+			m_Length = 0;
+		}
+
+		bool IsEmpty() const { return m_Length == 0 || m_Ptr == nullptr; }
+
+		TValue& operator[](size_t InIndex) { return m_Ptr[InIndex]; }
+		const TValue& operator[](size_t InIndex) const { return m_Ptr[InIndex]; }
+
+		size_t Length() const { return m_Length; }
+		size_t ByteLength() const { return m_Length * sizeof(TValue); }
+
+		TValue* Data() { return m_Ptr; }
+		const TValue* Data() const { return m_Ptr; }
+
+		TValue* begin() { return m_Ptr; }
+		TValue* end() { return m_Ptr + m_Length; }
+
+		const TValue* begin() const { return m_Ptr; }
+		const TValue* end() const { return m_Ptr + m_Length; }
+
+	private:
+		// Matches the first three fields of Coral::Array, the pin handle takes the place of m_ArrayHandle
+		alignas(8) TValue* m_Ptr = nullptr;
+		alignas(8) void* m_PinHandle = nullptr;
+		alignas(8) int32_t m_Length = 0;
+	};
+
+	static_assert(sizeof(ArrayView<char>) == 24);
+
+}
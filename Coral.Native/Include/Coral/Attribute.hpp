@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "String.hpp"
+#include "Utility.hpp"
 
 namespace Coral {
 
@@ -15,6 +16,7 @@ namespace Coral {
 		template<typename TReturn>
 		TReturn GetFieldValue(std::string_view InFieldName)
 		{
+			ValidateReturnType<TReturn>();
 			TReturn result;
 			GetFieldValueInternal(InFieldName, &result);
 			return result;
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core.hpp"
+
+#include <type_traits>
+
+namespace Coral {
+
+	// A constructor resolved with Type::GetConstructorHandle, creating an instance through it skips the signature lookup
+	// and runs a compiled factory instead of going through reflection.
+	class ConstructorHandle
+	{
+	public:
+		bool IsValid() const { return m_Handle != -1; }
+
+		bool operator==(const ConstructorHandle& InOther) const { return m_Handle == InOther.m_Handle; }
+		bool operator!=(const ConstructorHandle& InOther) const { return m_Handle != InOther.m_Handle; }
+
+	private:
+		ManagedHandle m_Handle = -1;
+
+		friend class Type;
+	};
+
+	// Keeps Type::CreateInstance(TArgs&&...) from taking a ConstructorHandle as a constructor argument
+	template<typename... TArgs>
+	struct IsConstructorHandleFirst : std::false_type {};
+
+	template<typename TFirst, typename... TRest>
+	struct IsConstructorHandleFirst<TFirst, TRest...> : std::is_same<std::decay_t<TFirst>, ConstructorHandle> {};
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// When enabled, ManagedObject::Destroy pushes the handle onto a lock-free queue instead of calling into managed code.
+	// The queued handles are freed together by Flush, e.g at the end of a frame or on a background thread.
+	// HostInstance::UnloadAssemblyLoadContext and HostInstance::Shutdown flush the queue, so no queued handle outlives the host.
+	class DestroyQueue
+	{
+	public:
+		// Disabling the queue flushes it, handles pushed by threads that are still destroying objects at that point
+		// stay queued until the next Flush
+		static void SetEnabled(bool InEnabled);
+		static bool IsEnabled();
+
+		// Safe to call from any thread
+		static void Push(void* InHandle);
+
+		// Frees every handle queued so far, returns how many were freed
+		static size_t Flush();
+	};
+
+}
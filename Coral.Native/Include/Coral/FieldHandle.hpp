@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// Obtained from Type::GetFieldHandle or FieldInfo::GetHandle, valid for any instance of the type until its AssemblyLoadContext is unloaded.
+	class FieldHandle
+	{
+	public:
+		bool IsValid() const { return m_Handle != -1; }
+
+		bool operator==(const FieldHandle& InOther) const { return m_Handle == InOther.m_Handle; }
+		bool operator!=(const FieldHandle& InOther) const { return m_Handle != InOther.m_Handle; }
+
+	private:
+		ManagedHandle m_Handle = -1;
+
+		friend class Type;
+		friend class ManagedObject;
+		friend class ManagedObjectRef;
+		friend class FieldInfo;
+	};
+
+}
@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "String.hpp"
+#include "FieldHandle.hpp"
 
 namespace Coral {
 
@@ -18,6 +19,8 @@ namespace Coral {
 
 		std::vector<Attribute> GetAttributes() const;
 
+		FieldHandle GetHandle() const;
+
 	private:
 		ManagedHandle m_Handle = -1;
 		Type* m_Type = nullptr;
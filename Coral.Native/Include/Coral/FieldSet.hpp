@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Core.hpp"
+#include "FieldHandle.hpp"
+
+namespace Coral {
+
+	// Where a field is stored in the native struct that a FieldSet copies to and from.
+	// bool fields are stored as Bool32 and string fields as Coral::String, the same as for GetFieldValue.
+	struct FieldBinding
+	{
+		FieldHandle Field;
+		uint32_t Offset = 0;
+	};
+
+	// Created by Type::CreateFieldSet, lets ManagedObject::ReadFields / WriteFields copy all bound fields in a single call.
+	class FieldSet
+	{
+	public:
+		bool IsValid() const { return m_Handle != -1; }
+
+		bool operator==(const FieldSet& InOther) const { return m_Handle == InOther.m_Handle; }
+		bool operator!=(const FieldSet& InOther) const { return m_Handle != InOther.m_Handle; }
+
+	private:
+		ManagedHandle m_Handle = -1;
+
+		friend class Type;
+		friend class ManagedObject;
+	};
+
+}
@@ -24,6 +24,9 @@ namespace Coral {
 		static void Collect(int32_t InGeneration, GCCollectionMode InCollectionMode = GCCollectionMode::Default, bool InBlocking = true, bool InCompacting = false);
 
 		static void WaitForPendingFinalizers();
+
+		// Bytes allocated on the managed heap by the calling thread, used to check that calls into managed code don't allocate
+		static int64_t GetAllocatedBytesForCurrentThread();
 	};
 	
 }
@@ -24,6 +24,13 @@ namespace Coral {
 		ExceptionCallbackFn ExceptionCallback = nullptr;
 	};
 
+	struct StringInterningStats
+	{
+		int64_t Hits = 0;
+		int64_t Misses = 0;
+		int32_t Count = 0;
+	};
+
 	enum class CoralInitStatus
 	{
 		Success,
@@ -45,6 +52,22 @@ namespace Coral {
 		// This does not affect the behaviour of LoadAssembly from native code.
 		AssemblyLoadContext CreateAssemblyLoadContext(std::string_view InName, std::string_view InDllPath);
 
+		// Method invocations and field / property accesses go through compiled stubs by default, disabling them falls back to reflection.
+		void SetCompiledInvokersEnabled(bool InEnabled);
+
+		// Tracks every object handle given to native code and reports the ones still alive when an AssemblyLoadContext is unloaded.
+		// Enabled by default in debug builds of Coral.Managed.
+		void SetHandleTrackingEnabled(bool InEnabled);
+
+		// Hands out the same handle every time an object is passed to native code, so copies of a ManagedObject compare equal by handle.
+		// The handle is only freed once all of them have been destroyed. Disabled by default.
+		void SetObjectIdentityEnabled(bool InEnabled);
+
+		// String parameters and fields passed to managed code are decoded once and the same System.String is returned for the same text afterwards,
+		// up to InCapacity distinct strings. Changing the setting starts over with an empty cache and stats. Disabled by default.
+		void SetStringInterningEnabled(bool InEnabled, int32_t InCapacity = 4096);
+		StringInterningStats GetStringInterningStats() const;
+
 	private:
 		bool LoadHostFXR() const;
 		bool InitializeCoralManaged();
@@ -3,6 +3,11 @@
 #include "Core.hpp"
 #include "Utility.hpp"
 #include "String.hpp"
+#include "MemberName.hpp"
+#include "MethodHandle.hpp"
+#include "FieldHandle.hpp"
+#include "PropertyHandle.hpp"
+#include "FieldSet.hpp"
 
 namespace Coral {
 
@@ -21,17 +26,19 @@ namespace Coral {
 		ManagedObject& operator=(ManagedObject&& InOther) noexcept;
 
 		template<typename TReturn, typename... TArgs>
-		TReturn InvokeMethod(std::string_view InMethodName, TArgs&&... InParameters) const
+		TReturn InvokeMethod(MemberName InMethodName, TArgs&&... InParameters) const
 		{
 			constexpr size_t parameterCount = sizeof...(InParameters);
 
+			ValidateReturnType<TReturn>();
 			TReturn result;
 			
 			if constexpr (parameterCount > 0)
 			{
 				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
 				ManagedType parameterTypes[parameterCount];
-				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				AddToArray<TArgs...>(parameterValues, argumentStorage, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
 				InvokeMethodRetInternal(InMethodName, parameterValues, parameterTypes, parameterCount, &result);
 			}
 			else
@@ -43,15 +50,16 @@ namespace Coral {
 		}
 
 		template<typename... TArgs>
-		void InvokeMethod(std::string_view InMethodName, TArgs&&... InParameters) const
+		void InvokeMethod(MemberName InMethodName, TArgs&&... InParameters) const
 		{
 			constexpr size_t parameterCount = sizeof...(InParameters);
 
 			if constexpr (parameterCount > 0)
 			{
 				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
 				ManagedType parameterTypes[parameterCount];
-				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				AddToArray<TArgs...>(parameterValues, argumentStorage, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
 				InvokeMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount);
 			}
 			else
@@ -60,38 +68,156 @@ namespace Coral {
 			}
 		}
 
+		template<typename TReturn, typename... TArgs>
+		TReturn InvokeMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			ValidateReturnType<TReturn>();
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodHandleInternal(InMethod, parameterValues, parameterCount, &result);
+			}
+			else
+			{
+				InvokeMethodHandleInternal(InMethod, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template<typename... TArgs>
+		void InvokeMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodHandleInternal(InMethod, parameterValues, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeMethodHandleInternal(InMethod, nullptr, 0, nullptr);
+			}
+		}
+
+		// Invokes InMethod on all InCount objects with the same parameters in a single call into managed code, return values are discarded.
+		// An exception only fails the call for the object that threw, OutResults (optional) receives whether each call succeeded.
+		// Returns the number of calls that failed.
+		template<typename... TArgs>
+		static size_t InvokeBatch(const MethodHandle& InMethod, const ManagedObject* InObjects, size_t InCount, Bool32* OutResults, TArgs&&... InParameters)
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				return InvokeBatchRaw(InMethod, &InObjects->m_Handle, sizeof(ManagedObject), InCount, parameterValues, parameterCount, 0, OutResults);
+			}
+			else
+			{
+				return InvokeBatchRaw(InMethod, &InObjects->m_Handle, sizeof(ManagedObject), InCount, nullptr, 0, 0, OutResults);
+			}
+		}
+
+		// InObjectHandles points to the first object handle, each following handle is InObjectStride bytes further (sizeof(ManagedObject) for an array of objects).
+		// Object i uses the InParameterCount parameters starting at InParameters[i * InParameterStride], a stride of 0 passes the same parameters to every object.
+		static size_t InvokeBatchRaw(const MethodHandle& InMethod, void* const* InObjectHandles, size_t InObjectStride, size_t InCount, const void** InParameters, size_t InParameterCount, size_t InParameterStride, Bool32* OutResults);
+
 		template<typename TValue>
-		void SetFieldValue(std::string_view InFieldName, TValue InValue) const
+		void SetFieldValue(MemberName InFieldName, TValue InValue) const
 		{
 			SetFieldValueRaw(InFieldName, &InValue);
 		}
 
 		template<typename TReturn>
-		TReturn GetFieldValue(std::string_view InFieldName) const
+		TReturn GetFieldValue(MemberName InFieldName) const
 		{
+			ValidateReturnType<TReturn>();
 			TReturn result;
 			GetFieldValueRaw(InFieldName, &result);
 			return result;
 		}
 
 		template<typename TValue>
-		void SetPropertyValue(std::string_view InPropertyName, TValue InValue) const
+		void SetPropertyValue(MemberName InPropertyName, TValue InValue) const
 		{
 			SetPropertyValueRaw(InPropertyName, &InValue);
 		}
 
 		template<typename TReturn>
-		TReturn GetPropertyValue(std::string_view InPropertyName) const
+		TReturn GetPropertyValue(MemberName InPropertyName) const
 		{
+			ValidateReturnType<TReturn>();
 			TReturn result;
 			GetPropertyValueRaw(InPropertyName, &result);
 			return result;
 		}
 
-		void SetFieldValueRaw(std::string_view InFieldName, void* InValue) const;
-		void GetFieldValueRaw(std::string_view InFieldName, void* OutValue) const;
-		void SetPropertyValueRaw(std::string_view InPropertyName, void* InValue) const;
-		void GetPropertyValueRaw(std::string_view InPropertyName, void* OutValue) const;
+		template<typename TValue>
+		void SetFieldValue(const FieldHandle& InField, TValue InValue) const
+		{
+			SetFieldValueRaw(InField, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetFieldValue(const FieldHandle& InField) const
+		{
+			ValidateReturnType<TReturn>();
+			TReturn result;
+			GetFieldValueRaw(InField, &result);
+			return result;
+		}
+
+		template<typename TValue>
+		void SetPropertyValue(const PropertyHandle& InProperty, TValue InValue) const
+		{
+			SetPropertyValueRaw(InProperty, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetPropertyValue(const PropertyHandle& InProperty) const
+		{
+			ValidateReturnType<TReturn>();
+			TReturn result;
+			GetPropertyValueRaw(InProperty, &result);
+			return result;
+		}
+
+		void SetFieldValueRaw(MemberName InFieldName, void* InValue) const;
+		void GetFieldValueRaw(MemberName InFieldName, void* OutValue) const;
+		void SetPropertyValueRaw(MemberName InPropertyName, void* InValue) const;
+		void GetPropertyValueRaw(MemberName InPropertyName, void* OutValue) const;
+		void SetFieldValueRaw(const FieldHandle& InField, void* InValue) const;
+		void GetFieldValueRaw(const FieldHandle& InField, void* OutValue) const;
+		void SetPropertyValueRaw(const PropertyHandle& InProperty, void* InValue) const;
+		void GetPropertyValueRaw(const PropertyHandle& InProperty, void* OutValue) const;
+
+		// Copies every field in the set to / from the native struct described by the set in one call.
+		// Strings read into OutBuffer are owned by the caller and have to be freed with String::Free.
+		void ReadFields(const FieldSet& InFieldSet, void* OutBuffer) const;
+		void WriteFields(const FieldSet& InFieldSet, const void* InBuffer) const;
+
+		// Attaches a native pointer to the managed object itself, every handle to the object (including a NativeInstance<T> passed to an
+		// internal call) sees the same pointer. InDeleter is called when the pointer is replaced, or on the finalizer thread once the object has been collected.
+		void SetUserData(void* InData, void (*InDeleter)(void*) = nullptr) const;
+		void* GetUserData() const;
+
+		template<typename TData>
+		TData* GetUserData() const
+		{
+			return static_cast<TData*>(GetUserData());
+		}
 
 		const Type& GetType();
 		
@@ -100,8 +226,9 @@ namespace Coral {
 		bool IsValid() const { return m_Handle != nullptr && m_Type != nullptr; }
 
 	private:
-		void InvokeMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
-		void InvokeMethodRetInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void InvokeMethodInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
+		void InvokeMethodRetInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void InvokeMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const;
 
 	public:
 		alignas(8) void* m_Handle = nullptr;
@@ -117,7 +244,7 @@ namespace Coral {
 	static_assert(sizeof(ManagedObject) == 16);
 
 	template<>
-	inline void ManagedObject::SetFieldValue(std::string_view InFieldName, std::string InValue) const
+	inline void ManagedObject::SetFieldValue(MemberName InFieldName, std::string InValue) const
 	{
 		String s = String::New(InValue);
 		SetFieldValueRaw(InFieldName, &s);
@@ -125,14 +252,14 @@ namespace Coral {
 	}
 
 	template<>
-	inline void ManagedObject::SetFieldValue(std::string_view InFieldName, bool InValue) const
+	inline void ManagedObject::SetFieldValue(MemberName InFieldName, bool InValue) const
 	{
 		Bool32 s = InValue;
 		SetFieldValueRaw(InFieldName, &s);
 	}
 
 	template<>
-	inline std::string ManagedObject::GetFieldValue(std::string_view InFieldName) const
+	inline std::string ManagedObject::GetFieldValue(MemberName InFieldName) const
 	{
 		String result;
 		GetFieldValueRaw(InFieldName, &result);
@@ -142,12 +269,70 @@ namespace Coral {
 	}
 
 	template<>
-	inline bool ManagedObject::GetFieldValue(std::string_view InFieldName) const
+	inline bool ManagedObject::GetFieldValue(MemberName InFieldName) const
 	{
 		Bool32 result;
 		GetFieldValueRaw(InFieldName, &result);
 		return result;
 	}
 
-}
+	template<>
+	inline void ManagedObject::SetFieldValue(const FieldHandle& InField, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetFieldValueRaw(InField, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObject::SetFieldValue(const FieldHandle& InField, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetFieldValueRaw(InField, &s);
+	}
 
+	template<>
+	inline std::string ManagedObject::GetFieldValue(const FieldHandle& InField) const
+	{
+		String result;
+		GetFieldValueRaw(InField, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetFieldValue(const FieldHandle& InField) const
+	{
+		Bool32 result;
+		GetFieldValueRaw(InField, &result);
+		return result;
+	}
+
+	template<>
+	inline void ManagedObject::SetPropertyValue(const PropertyHandle& InProperty, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetPropertyValueRaw(InProperty, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline std::string ManagedObject::GetPropertyValue(const PropertyHandle& InProperty) const
+	{
+		String result;
+		GetPropertyValueRaw(InProperty, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObject::GetPropertyValue(const PropertyHandle& InProperty) const
+	{
+		Bool32 result;
+		GetPropertyValueRaw(InProperty, &result);
+		return result;
+	}
+
+}
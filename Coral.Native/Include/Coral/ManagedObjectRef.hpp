@@ -0,0 +1,164 @@
+#pragma once
+
+#include "ManagedObject.hpp"
+
+namespace Coral {
+
+	class Type;
+
+	// An 8 byte reference to an object stored in Coral's managed object table, meant for large arrays of objects where a
+	// ManagedObject per element would be too big. The table keeps the object alive until Release is called, the generation
+	// makes references to a released slot invalid even after the slot has been reused.
+	// Copies refer to the same slot, so only one of them should call Release.
+	class ManagedObjectRef
+	{
+	public:
+		// Adds the object to the table, InObject stays valid and still has to be destroyed
+		static ManagedObjectRef Create(const ManagedObject& InObject);
+
+		void Release();
+
+		// Whether the slot still holds the object, false once it has been released
+		bool IsAlive() const;
+
+		// Returns a ManagedObject with its own handle to the object
+		ManagedObject Lock() const;
+
+		// The Type of the ManagedObject the ref was created from, stored with the slot
+		const Type& GetType() const;
+
+		template<typename TReturn, typename... TArgs>
+		TReturn InvokeMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			ValidateReturnType<TReturn>();
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodInternal(InMethod, parameterValues, parameterCount, &result);
+			}
+			else
+			{
+				InvokeMethodInternal(InMethod, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template<typename... TArgs>
+		void InvokeMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeMethodInternal(InMethod, parameterValues, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeMethodInternal(InMethod, nullptr, 0, nullptr);
+			}
+		}
+
+		// Same as ManagedObject::InvokeBatch, the objects are looked up by index instead of through their GCHandles
+		template<typename... TArgs>
+		static size_t InvokeBatch(const MethodHandle& InMethod, const ManagedObjectRef* InObjects, size_t InCount, Bool32* OutResults, TArgs&&... InParameters)
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				return InvokeBatchRaw(InMethod, InObjects, InCount, parameterValues, parameterCount, 0, OutResults);
+			}
+			else
+			{
+				return InvokeBatchRaw(InMethod, InObjects, InCount, nullptr, 0, 0, OutResults);
+			}
+		}
+
+		static size_t InvokeBatchRaw(const MethodHandle& InMethod, const ManagedObjectRef* InObjects, size_t InCount, const void** InParameters, size_t InParameterCount, size_t InParameterStride, Bool32* OutResults);
+
+		template<typename TValue>
+		void SetFieldValue(const FieldHandle& InField, TValue InValue) const
+		{
+			SetFieldValueRaw(InField, &InValue);
+		}
+
+		template<typename TReturn>
+		TReturn GetFieldValue(const FieldHandle& InField) const
+		{
+			ValidateReturnType<TReturn>();
+			TReturn result;
+			GetFieldValueRaw(InField, &result);
+			return result;
+		}
+
+		void SetFieldValueRaw(const FieldHandle& InField, void* InValue) const;
+		void GetFieldValueRaw(const FieldHandle& InField, void* OutValue) const;
+
+		uint32_t GetIndex() const { return m_Index; }
+		uint32_t GetGeneration() const { return m_Generation; }
+
+		// Generation 0 is never used by the table, a default constructed ref is always invalid
+		bool IsValid() const { return m_Generation != 0; }
+
+		bool operator==(const ManagedObjectRef& InOther) const { return m_Index == InOther.m_Index && m_Generation == InOther.m_Generation; }
+		bool operator!=(const ManagedObjectRef& InOther) const { return !(*this == InOther); }
+
+	private:
+		uint64_t GetValue() const { return (static_cast<uint64_t>(m_Generation) << 32) | m_Index; }
+
+		void InvokeMethodInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const;
+
+	private:
+		uint32_t m_Index = 0;
+		uint32_t m_Generation = 0;
+	};
+
+	static_assert(sizeof(ManagedObjectRef) == 8);
+
+	template<>
+	inline void ManagedObjectRef::SetFieldValue(const FieldHandle& InField, std::string InValue) const
+	{
+		String s = String::New(InValue);
+		SetFieldValueRaw(InField, &s);
+		String::Free(s);
+	}
+
+	template<>
+	inline void ManagedObjectRef::SetFieldValue(const FieldHandle& InField, bool InValue) const
+	{
+		Bool32 s = InValue;
+		SetFieldValueRaw(InField, &s);
+	}
+
+	template<>
+	inline std::string ManagedObjectRef::GetFieldValue(const FieldHandle& InField) const
+	{
+		String result;
+		GetFieldValueRaw(InField, &result);
+		auto s = result.Data() ? std::string(result) : "";
+		String::Free(result);
+		return s;
+	}
+
+	template<>
+	inline bool ManagedObjectRef::GetFieldValue(const FieldHandle& InField) const
+	{
+		Bool32 result;
+		GetFieldValueRaw(InField, &result);
+		return result;
+	}
+
+}
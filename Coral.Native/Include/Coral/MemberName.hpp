@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// Name of a method, field or property passed to managed code without allocating. Coral.Managed caches the decoded
+	// System.String by hash, so after the first call with a given name no string is created on either side.
+	// A MemberName only points to the characters, they have to outlive any call it's passed to.
+	class MemberName
+	{
+	public:
+		constexpr MemberName(const char* InName)
+			: MemberName(std::string_view(InName)) {}
+
+		constexpr MemberName(std::string_view InName)
+			: m_Data(InName.data()), m_Length(static_cast<int32_t>(InName.size())), m_Hash(Hash(InName)) {}
+
+		MemberName(const std::string& InName)
+			: MemberName(std::string_view(InName)) {}
+
+		constexpr std::string_view GetName() const { return { m_Data, static_cast<size_t>(m_Length) }; }
+		constexpr uint64_t GetHash() const { return m_Hash; }
+
+		// 64-bit FNV-1a
+		static constexpr uint64_t Hash(std::string_view InName)
+		{
+			uint64_t hash = 14695981039346656037ull;
+
+			for (char c : InName)
+			{
+				hash ^= static_cast<uint8_t>(c);
+				hash *= 1099511628211ull;
+			}
+
+			return hash;
+		}
+
+	private:
+		const char* m_Data = nullptr;
+		int32_t m_Length = 0;
+		uint64_t m_Hash = 0;
+	};
+
+	static_assert(sizeof(MemberName) == 24);
+
+}
+
+// Builds a Coral::MemberName with the hash computed at compile time, e.g `object.InvokeMethod(CORAL_NAME("OnUpdate"), deltaTime)`
+#define CORAL_NAME(InName) ([]() { constexpr ::Coral::MemberName coralMemberName(InName); return coralMemberName; }())
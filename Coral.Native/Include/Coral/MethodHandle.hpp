@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// A method that has already been resolved on the managed side, invoking through a handle
+	// skips the name and signature lookup that `InvokeMethod(std::string_view, ...)` does on every call.
+	class MethodHandle
+	{
+	public:
+		bool IsValid() const { return m_Handle != -1; }
+
+		bool operator==(const MethodHandle& InOther) const { return m_Handle == InOther.m_Handle; }
+		bool operator!=(const MethodHandle& InOther) const { return m_Handle != InOther.m_Handle; }
+
+	private:
+		ManagedHandle m_Handle = -1;
+
+		friend class Type;
+		friend class ManagedObject;
+		friend class ManagedObjectRef;
+		friend class MethodInfo;
+	};
+
+}
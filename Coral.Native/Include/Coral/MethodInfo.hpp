@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "String.hpp"
+#include "MethodHandle.hpp"
 
 namespace Coral {
 
@@ -20,6 +21,8 @@ namespace Coral {
 
 		std::vector<Attribute> GetAttributes() const;
 
+		MethodHandle GetHandle() const;
+
 	private:
 		ManagedHandle m_Handle = -1;
 		Type* m_ReturnType = nullptr;
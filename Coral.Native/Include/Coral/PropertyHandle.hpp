@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// Obtained from Type::GetPropertyHandle or PropertyInfo::GetHandle.
+	class PropertyHandle
+	{
+	public:
+		bool IsValid() const { return m_Handle != -1; }
+
+		bool operator==(const PropertyHandle& InOther) const { return m_Handle == InOther.m_Handle; }
+		bool operator!=(const PropertyHandle& InOther) const { return m_Handle != InOther.m_Handle; }
+
+	private:
+		ManagedHandle m_Handle = -1;
+
+		friend class Type;
+		friend class ManagedObject;
+		friend class PropertyInfo;
+	};
+
+}
@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "String.hpp"
+#include "PropertyHandle.hpp"
 
 namespace Coral {
 
@@ -16,6 +17,8 @@ namespace Coral {
 
 		std::vector<Attribute> GetAttributes() const;
 
+		PropertyHandle GetHandle() const;
+
 	private:
 		ManagedHandle m_Handle = -1;
 		Type* m_Type = nullptr;
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ManagedObject.hpp"
+
+#include <atomic>
+
+namespace Coral {
+
+	// Shares a single managed handle between all of its copies. Copying or destroying a SharedManagedObject only touches
+	// an atomic reference count, the handle is freed in managed code when the last copy is destroyed.
+	class SharedManagedObject
+	{
+	public:
+		SharedManagedObject() = default;
+
+		// Takes over the handle owned by InObject
+		explicit SharedManagedObject(ManagedObject&& InObject);
+
+		SharedManagedObject(const SharedManagedObject& InOther);
+		SharedManagedObject(SharedManagedObject&& InOther) noexcept;
+		~SharedManagedObject();
+
+		SharedManagedObject& operator=(const SharedManagedObject& InOther);
+		SharedManagedObject& operator=(SharedManagedObject&& InOther) noexcept;
+
+		ManagedObject* Get() const { return m_Block ? &m_Block->Object : nullptr; }
+		ManagedObject* operator->() const { return Get(); }
+		ManagedObject& operator*() const { return m_Block->Object; }
+
+		uint32_t GetRefCount() const { return m_Block ? m_Block->RefCount.load(std::memory_order_relaxed) : 0; }
+
+		void Reset();
+
+		bool IsValid() const { return m_Block != nullptr && m_Block->Object.IsValid(); }
+
+		bool operator==(const SharedManagedObject& InOther) const { return m_Block == InOther.m_Block; }
+		bool operator!=(const SharedManagedObject& InOther) const { return m_Block != InOther.m_Block; }
+
+	private:
+		struct ControlBlock
+		{
+			ManagedObject Object;
+			std::atomic<uint32_t> RefCount = 1;
+		};
+
+		ControlBlock* m_Block = nullptr;
+	};
+
+}
@@ -6,11 +6,20 @@
 #include "MethodInfo.hpp"
 #include "FieldInfo.hpp"
 #include "PropertyInfo.hpp"
+#include "FieldSet.hpp"
+#include "ConstructorHandle.hpp"
 
 #include <optional>
 
 namespace Coral {
 
+	struct PoolStats
+	{
+		int64_t Hits = 0;
+		int64_t Misses = 0;
+		int32_t PooledCount = 0;
+	};
+
 	class Type
 	{
 	public:
@@ -44,8 +53,80 @@ namespace Coral {
 
 		TypeId GetTypeId() const { return m_Id; }
 
+		MethodHandle GetMethodHandle(std::string_view InMethodName, const ManagedType* InParameterTypes, size_t InParameterCount) const;
+		ConstructorHandle GetConstructorHandle(const ManagedType* InParameterTypes, size_t InParameterCount) const;
+		FieldHandle GetFieldHandle(std::string_view InFieldName) const;
+		PropertyHandle GetPropertyHandle(std::string_view InPropertyName) const;
+
+		// InBufferSize is the size of the native struct, every binding has to fit inside of it
+		FieldSet CreateFieldSet(const std::vector<FieldBinding>& InBindings, size_t InBufferSize) const;
+
+		template<typename TStruct>
+		FieldSet CreateFieldSet(const std::vector<FieldBinding>& InBindings) const
+		{
+			return CreateFieldSet(InBindings, sizeof(TStruct));
+		}
+
 	public:
+		// Returns a pointer that calls the static method directly, the managed signature has to match TFunc (e.g `int32_t(float, Coral::Bool32)`).
+		// Structs are only checked by size. The pointer is invalid once the owning AssemblyLoadContext has been unloaded.
+		template<typename TFunc>
+		typename FunctionTraits<TFunc>::FunctionPointer GetFunctionPointer(std::string_view InMethodName) const
+		{
+			using Traits = FunctionTraits<TFunc>;
+
+			void* functionPtr = nullptr;
+
+			if constexpr (Traits::ParameterCount > 0)
+			{
+				ManagedType parameterTypes[Traits::ParameterCount];
+				int32_t parameterSizes[Traits::ParameterCount];
+				Traits::GetParameters(parameterTypes, parameterSizes);
+				functionPtr = GetFunctionPointerInternal(InMethodName, Traits::GetReturnType(), Traits::GetReturnSize(), parameterTypes, parameterSizes, Traits::ParameterCount);
+			}
+			else
+			{
+				functionPtr = GetFunctionPointerInternal(InMethodName, Traits::GetReturnType(), Traits::GetReturnSize(), nullptr, nullptr, 0);
+			}
+
+			return reinterpret_cast<typename Traits::FunctionPointer>(functionPtr);
+		}
+
+		template<typename... TArgs>
+		MethodHandle GetMethodHandle(std::string_view InMethodName) const
+		{
+			constexpr size_t parameterCount = sizeof...(TArgs);
+
+			if constexpr (parameterCount > 0)
+			{
+				ManagedType parameterTypes[parameterCount];
+				GetManagedTypes<TArgs...>(parameterTypes);
+				return GetMethodHandle(InMethodName, parameterTypes, parameterCount);
+			}
+			else
+			{
+				return GetMethodHandle(InMethodName, nullptr, 0);
+			}
+		}
+
 		template<typename... TArgs>
+		ConstructorHandle GetConstructorHandle() const
+		{
+			constexpr size_t parameterCount = sizeof...(TArgs);
+
+			if constexpr (parameterCount > 0)
+			{
+				ManagedType parameterTypes[parameterCount];
+				GetManagedTypes<TArgs...>(parameterTypes);
+				return GetConstructorHandle(parameterTypes, parameterCount);
+			}
+			else
+			{
+				return GetConstructorHandle(nullptr, 0);
+			}
+		}
+
+		template<typename... TArgs, typename = std::enable_if_t<!IsConstructorHandleFirst<TArgs...>::value>>
 		ManagedObject CreateInstance(TArgs&&... InArguments) const
 		{
 			constexpr size_t argumentCount = sizeof...(InArguments);
@@ -55,8 +136,9 @@ namespace Coral {
 			if constexpr (argumentCount > 0)
 			{
 				const void* argumentsArr[argumentCount];
+				ArgumentStorage<TArgs...> argumentStorage;
 				ManagedType argumentTypes[argumentCount];
-				AddToArray<TArgs...>(argumentsArr, argumentTypes, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
+				AddToArray<TArgs...>(argumentsArr, argumentStorage, argumentTypes, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
 				result = CreateInstanceInternal(argumentsArr, argumentTypes, argumentCount);
 			}
 			else
@@ -67,18 +149,78 @@ namespace Coral {
 			return result;
 		}
 
+		template<typename... TArgs>
+		ManagedObject CreateInstance(const ConstructorHandle& InConstructor, TArgs&&... InArguments) const
+		{
+			constexpr size_t argumentCount = sizeof...(InArguments);
+
+			ManagedObject result;
+
+			if constexpr (argumentCount > 0)
+			{
+				const void* argumentsArr[argumentCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(argumentsArr, argumentStorage, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
+				result = CreateInstanceHandleInternal(InConstructor, argumentsArr, argumentCount);
+			}
+			else
+			{
+				result = CreateInstanceHandleInternal(InConstructor, nullptr, 0);
+			}
+
+			return result;
+		}
+
+		// Creates InCount objects with the same arguments in a single call into managed code and returns how many were created,
+		// objects that couldn't be created are left invalid. Any objects already in OutObjects are destroyed first.
+		template<typename... TArgs>
+		size_t CreateInstances(const ConstructorHandle& InConstructor, ManagedObject* OutObjects, size_t InCount, TArgs&&... InArguments) const
+		{
+			constexpr size_t argumentCount = sizeof...(InArguments);
+
+			if constexpr (argumentCount > 0)
+			{
+				const void* argumentsArr[argumentCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(argumentsArr, argumentStorage, std::forward<TArgs>(InArguments)..., std::make_index_sequence<argumentCount> {});
+				return CreateInstancesRaw(InConstructor, OutObjects, InCount, argumentsArr, argumentCount, 0);
+			}
+			else
+			{
+				return CreateInstancesRaw(InConstructor, OutObjects, InCount, nullptr, 0, 0);
+			}
+		}
+
+		template<typename... TArgs>
+		size_t CreateInstances(ManagedObject* OutObjects, size_t InCount, TArgs&&... InArguments) const
+		{
+			return CreateInstances(GetConstructorHandle<TArgs...>(), OutObjects, InCount, std::forward<TArgs>(InArguments)...);
+		}
+
+		// Object i is constructed with the InParameterCount arguments starting at InParameters[i * InParameterStride], a stride of 0 passes the same arguments to every object.
+		size_t CreateInstancesRaw(const ConstructorHandle& InConstructor, ManagedObject* OutObjects, size_t InCount, const void** InParameters, size_t InParameterCount, size_t InParameterStride) const;
+
+		// Up to InCapacity destroyed instances are kept alive and handed out again when an instance is created without constructor arguments.
+		// Instances implementing Coral.Managed.IPoolable are reset before being pooled. Only the ManagedObject returned by CreateInstance
+		// returns the instance to the pool, copies and weak references are freed as usual and shouldn't be used after it has been destroyed.
+		void EnablePooling(int32_t InCapacity) const;
+		void DisablePooling() const;
+		PoolStats GetPoolStats() const;
+
 		template <typename TReturn, typename... TArgs>
-		TReturn InvokeStaticMethod(std::string_view InMethodName, TArgs&&... InParameters) const
+		TReturn InvokeStaticMethod(MemberName InMethodName, TArgs&&... InParameters) const
 		{
 			constexpr size_t parameterCount = sizeof...(InParameters);
 
+			ValidateReturnType<TReturn>();
 			TReturn result;
 
 			if constexpr (parameterCount > 0)
 			{
 				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
 				ManagedType parameterTypes[parameterCount];
-				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				AddToArray<TArgs...>(parameterValues, argumentStorage, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
 				InvokeStaticMethodRetInternal(InMethodName, parameterValues, parameterTypes, parameterCount, &result);
 			}
 			else
@@ -90,15 +232,16 @@ namespace Coral {
 		}
 
 		template <typename... TArgs>
-		void InvokeStaticMethod(std::string_view InMethodName, TArgs&&... InParameters)
+		void InvokeStaticMethod(MemberName InMethodName, TArgs&&... InParameters)
 		{
 			constexpr size_t parameterCount = sizeof...(InParameters);
 
 			if constexpr (parameterCount > 0)
 			{
 				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
 				ManagedType parameterTypes[parameterCount];
-				AddToArray<TArgs...>(parameterValues, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				AddToArray<TArgs...>(parameterValues, argumentStorage, parameterTypes, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
 				InvokeStaticMethodInternal(InMethodName, parameterValues, parameterTypes, parameterCount);
 			}
 			else
@@ -107,10 +250,54 @@ namespace Coral {
 			}
 		}
 
+		template <typename TReturn, typename... TArgs>
+		TReturn InvokeStaticMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			ValidateReturnType<TReturn>();
+			TReturn result;
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodHandleInternal(InMethod, parameterValues, parameterCount, &result);
+			}
+			else
+			{
+				InvokeStaticMethodHandleInternal(InMethod, nullptr, 0, &result);
+			}
+
+			return result;
+		}
+
+		template <typename... TArgs>
+		void InvokeStaticMethod(const MethodHandle& InMethod, TArgs&&... InParameters) const
+		{
+			constexpr size_t parameterCount = sizeof...(InParameters);
+
+			if constexpr (parameterCount > 0)
+			{
+				const void* parameterValues[parameterCount];
+				ArgumentStorage<TArgs...> argumentStorage;
+				AddValuesToArray<TArgs...>(parameterValues, argumentStorage, std::forward<TArgs>(InParameters)..., std::make_index_sequence<parameterCount> {});
+				InvokeStaticMethodHandleInternal(InMethod, parameterValues, parameterCount, nullptr);
+			}
+			else
+			{
+				InvokeStaticMethodHandleInternal(InMethod, nullptr, 0, nullptr);
+			}
+		}
+
 	private:
 		ManagedObject CreateInstanceInternal(const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
-		void InvokeStaticMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
-		void InvokeStaticMethodRetInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		ManagedObject CreateInstanceHandleInternal(const ConstructorHandle& InConstructor, const void** InParameters, size_t InLength) const;
+		void InvokeStaticMethodInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const;
+		void InvokeStaticMethodRetInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const;
+		void* GetFunctionPointerInternal(std::string_view InMethodName, ManagedType InReturnType, int32_t InReturnSize, const ManagedType* InParameterTypes, const int32_t* InParameterSizes, size_t InParameterCount) const;
+		void InvokeStaticMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const;
 
 	private:
 		TypeId m_Id = -1;
@@ -127,6 +314,7 @@ namespace Coral {
 		friend class Attribute;
 		friend class ReflectionType;
 		friend class ManagedObject;
+		friend class ManagedObjectRef;
 	};
 
 	class ReflectionType
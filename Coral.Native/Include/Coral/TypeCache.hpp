@@ -3,6 +3,8 @@
 #include "Core.hpp"
 #include "StableVector.hpp"
 
+#include <mutex>
+
 namespace Coral {
 	class Type;
 
@@ -12,6 +14,7 @@ namespace Coral {
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
 		static TypeCache& Get();
 
+		// Returns the already cached Type if there's one with the same id, names are only fetched once GetTypeByName needs them
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
 		Type* CacheType(Type&& InType);
 
@@ -24,10 +27,18 @@ namespace Coral {
 		[[deprecated(CORAL_GLOBAL_ALC_MSG)]]
 		void Clear();
 
+	private:
+		void CacheNames() const;
+
 	private:
 		StableVector<Type> m_Types;
-		std::unordered_map<std::string, Type*> m_NameCache;
+		mutable std::unordered_map<std::string, Type*> m_NameCache;
 		std::unordered_map<TypeId, Type*> m_IDCache;
+
+		// Types that haven't been added to m_NameCache yet
+		mutable std::vector<Type*> m_UnnamedTypes;
+
+		mutable std::mutex m_Mutex;
 	};
 
 }
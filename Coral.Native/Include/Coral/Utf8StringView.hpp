@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace Coral {
+
+	// UTF-8 characters and their length passed to managed code without copying or converting them, received as
+	// Coral.Managed.Interop.NativeStringView. The characters don't have to be null terminated but have to outlive any call they're passed to.
+	// std::string_view arguments are converted into one of these before they cross into managed code.
+	class Utf8StringView
+	{
+	public:
+		constexpr Utf8StringView() = default;
+
+		constexpr Utf8StringView(const char* InString)
+			: Utf8StringView(std::string_view(InString)) {}
+
+		constexpr Utf8StringView(std::string_view InString)
+			: m_Data(InString.data()), m_Length(static_cast<int64_t>(InString.size())) {}
+
+		Utf8StringView(const std::string& InString)
+			: Utf8StringView(std::string_view(InString)) {}
+
+		constexpr const char* Data() const { return m_Data; }
+		constexpr size_t Size() const { return static_cast<size_t>(m_Length); }
+
+		constexpr operator std::string_view() const { return { m_Data, static_cast<size_t>(m_Length) }; }
+
+	private:
+		const char* m_Data = nullptr;
+		int64_t m_Length = 0;
+	};
+
+	static_assert(sizeof(Utf8StringView) == 16);
+
+}
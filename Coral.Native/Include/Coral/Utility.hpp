@@ -2,6 +2,7 @@
 
 #include "Core.hpp"
 #include "String.hpp"
+#include "Utf8StringView.hpp"
 
 namespace Coral {
 
@@ -26,8 +27,27 @@ namespace Coral {
 		String,
 
 		Pointer,
+
+		StringView,
 	};
 
+	template<typename TValue>
+	class Array;
+
+	template<typename TValue>
+	struct IsArray : std::false_type {};
+
+	template<typename TValue>
+	struct IsArray<Array<TValue>> : std::true_type {};
+
+	// Managed arrays are returned as a Coral::ArrayView<T> that unpins the array once it's destroyed,
+	// a Coral::Array<T> result would receive the pin and never release it
+	template<typename TReturn>
+	constexpr void ValidateReturnType()
+	{
+		static_assert(!IsArray<std::remove_cv_t<TReturn>>::value, "Managed arrays can only be returned as Coral::ArrayView<T>");
+	}
+
 	template<typename TArg>
 	constexpr ManagedType GetManagedType()
 	{
@@ -57,17 +77,32 @@ namespace Coral {
 			return ManagedType::Bool;
 		else if constexpr (std::is_same_v<TArg, std::string> || std::is_same_v<TArg, Coral::String>)
 			return ManagedType::String;
+		else if constexpr (std::is_same_v<TArg, Utf8StringView> || std::is_same_v<TArg, std::string_view>)
+			return ManagedType::StringView;
 		else
 			return ManagedType::Unknown;
 	}
 
-	template <typename TArg, size_t TIndex>
-	inline void AddToArrayI(const void** InArgumentsArr, ManagedType* InParameterTypes, TArg&& InArg)
+	template<typename TArg>
+	constexpr bool IsStdStringView = std::is_same_v<std::remove_cv_t<std::remove_reference_t<TArg>>, std::string_view>;
+
+	// The layout of std::string_view differs between standard libraries, so std::string_view arguments are copied
+	// into a Utf8StringView here first. Has to outlive the call the argument array is passed to.
+	template<typename... TArgs>
+	struct ArgumentStorage
 	{
-		ManagedType managedType = GetManagedType<std::remove_const_t<std::remove_reference_t<TArg>>>();
-		InParameterTypes[TIndex] = managedType;
+		Utf8StringView StringViews[(IsStdStringView<TArgs> || ...) ? sizeof...(TArgs) : 1];
+	};
 
-		if constexpr (std::is_pointer_v<std::remove_reference_t<TArg>>)
+	template <typename TArg, size_t TIndex>
+	inline void AddValueToArrayI(const void** InArgumentsArr, Utf8StringView* InStringViews, TArg&& InArg)
+	{
+		if constexpr (IsStdStringView<TArg>)
+		{
+			InStringViews[TIndex] = Utf8StringView(InArg);
+			InArgumentsArr[TIndex] = &InStringViews[TIndex];
+		}
+		else if constexpr (std::is_pointer_v<std::remove_reference_t<TArg>>)
 		{
 			InArgumentsArr[TIndex] = reinterpret_cast<const void*>(InArg);
 		}
@@ -77,14 +112,75 @@ namespace Coral {
 		}
 	}
 
+	template <typename TArg, size_t TIndex>
+	inline void AddToArrayI(const void** InArgumentsArr, Utf8StringView* InStringViews, ManagedType* InParameterTypes, TArg&& InArg)
+	{
+		ManagedType managedType = GetManagedType<std::remove_const_t<std::remove_reference_t<TArg>>>();
+		InParameterTypes[TIndex] = managedType;
+
+		AddValueToArrayI<TArg, TIndex>(InArgumentsArr, InStringViews, std::forward<TArg>(InArg));
+	}
+
+	// Used when the method has already been resolved and only the argument values need to be passed
+	template <typename... TArgs, size_t... TIndices>
+	inline void AddValuesToArray(const void** InArgumentsArr, ArgumentStorage<TArgs...>& InStorage, TArgs&&... InArgs, const std::index_sequence<TIndices...>&)
+	{
+		(AddValueToArrayI<TArgs, TIndices>(InArgumentsArr, InStorage.StringViews, std::forward<TArgs>(InArgs)), ...);
+	}
+
 	/*
 	 * TODO(Emily): Work out a way to allow method invoke to use C++-y types (i.e. `std::string` instead of `Coral::String`).
 	 * 				See Testing/Main.cpp:StringTest/BoolTest.
 	 */
 	template <typename... TArgs, size_t... TIndices>
-	inline void AddToArray(const void** InArgumentsArr, ManagedType* InParameterTypes, TArgs&&... InArgs, const std::index_sequence<TIndices...>&)
+	inline void AddToArray(const void** InArgumentsArr, ArgumentStorage<TArgs...>& InStorage, ManagedType* InParameterTypes, TArgs&&... InArgs, const std::index_sequence<TIndices...>&)
+	{
+		(AddToArrayI<TArgs, TIndices>(InArgumentsArr, InStorage.StringViews, InParameterTypes, std::forward<TArgs>(InArgs)), ...);
+	}
+
+	template <typename... TArgs>
+	inline void GetManagedTypes(ManagedType* InParameterTypes)
 	{
-		(AddToArrayI<TArgs, TIndices>(InArgumentsArr, InParameterTypes, std::forward<TArgs>(InArgs)), ...);
+		size_t index = 0;
+		((InParameterTypes[index++] = GetManagedType<std::remove_const_t<std::remove_reference_t<TArgs>>>()), ...);
 	}
 
+	template<typename TFunc>
+	struct FunctionTraits;
+
+	template<typename TReturn, typename... TArgs>
+	struct FunctionTraits<TReturn(TArgs...)>
+	{
+		static_assert(!(std::is_reference_v<TArgs> || ...), "Reference parameters can't cross into managed code, pass a pointer instead.");
+
+		using ReturnType = TReturn;
+		using FunctionPointer = TReturn(*)(TArgs...);
+
+		static constexpr size_t ParameterCount = sizeof...(TArgs);
+
+		static constexpr ManagedType GetReturnType()
+		{
+			if constexpr (std::is_void_v<TReturn>)
+				return ManagedType::Unknown;
+			else
+				return GetManagedType<std::remove_cv_t<TReturn>>();
+		}
+
+		static constexpr int32_t GetReturnSize()
+		{
+			if constexpr (std::is_void_v<TReturn>)
+				return 0;
+			else
+				return static_cast<int32_t>(sizeof(TReturn));
+		}
+
+		static void GetParameters(ManagedType* OutParameterTypes, int32_t* OutParameterSizes)
+		{
+			GetManagedTypes<TArgs...>(OutParameterTypes);
+
+			size_t index = 0;
+			((OutParameterSizes[index++] = static_cast<int32_t>(sizeof(TArgs))), ...);
+		}
+	};
+
 }
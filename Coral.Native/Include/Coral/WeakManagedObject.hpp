@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ManagedObject.hpp"
+
+namespace Coral {
+
+	// Refers to a managed object without keeping it alive. TryLock returns a strong ManagedObject as long as the
+	// object hasn't been collected yet, with InTrackResurrection the object can still be reached from its finalizer.
+	class WeakManagedObject
+	{
+	public:
+		WeakManagedObject() = default;
+		explicit WeakManagedObject(const ManagedObject& InObject, bool InTrackResurrection = false);
+
+		WeakManagedObject(const WeakManagedObject& InOther);
+		WeakManagedObject(WeakManagedObject&& InOther) noexcept;
+		~WeakManagedObject();
+
+		WeakManagedObject& operator=(const WeakManagedObject& InOther);
+		WeakManagedObject& operator=(WeakManagedObject&& InOther) noexcept;
+
+		bool IsAlive() const;
+
+		// Returns an invalid ManagedObject if the object has been collected
+		ManagedObject TryLock() const;
+
+		void Destroy();
+
+		bool IsValid() const { return m_Handle != nullptr; }
+
+	private:
+		void* m_Handle = nullptr;
+		const Type* m_Type = nullptr;
+		bool m_TrackResurrection = false;
+	};
+
+}
@@ -0,0 +1,12 @@
+#include "Coral/ArrayView.hpp"
+
+#include "CoralManagedFunctions.hpp"
+
+namespace Coral {
+
+	void ArrayPin::Release(void* InPinHandle)
+	{
+		s_ManagedFunctions.ReleaseArrayPinFptr(InPinHandle);
+	}
+
+}
@@ -2,15 +2,19 @@
 
 #include "Coral/Core.hpp"
 #include "Coral/String.hpp"
+#include "Coral/MemberName.hpp"
 
 namespace Coral {
 
 	struct UnmanagedArray;
 	enum class AssemblyLoadStatus;
 	class ManagedObject;
+	class Type;
 	enum class GCCollectionMode;
 	enum class ManagedType;
 	class ManagedField;
+	struct PoolStats;
+	struct StringInterningStats;
 
 	using SetInternalCallsFn = void (*)(int32_t, void*, int32_t);
 	using CreateAssemblyLoadContextFn = int32_t (*)(String, String);
@@ -75,20 +79,62 @@ namespace Coral {
 #pragma endregion
 
 	using CreateObjectFn = void* (*)(TypeId, Bool32, const void**, const ManagedType*, int32_t);
+	using ResolveConstructorFn = ManagedHandle (*)(TypeId, const ManagedType*, int32_t);
+	using CreateObjectWithConstructorFn = void* (*)(TypeId, ManagedHandle, Bool32, const void**, int32_t);
+	using CreateObjectsFn = int32_t (*)(TypeId, ManagedHandle, void**, int32_t, int32_t, const void**, int32_t, int32_t);
+	using EnablePoolingFn = void (*)(TypeId, int32_t);
+	using DisablePoolingFn = void (*)(TypeId);
+	using GetPoolStatsFn = void (*)(TypeId, PoolStats*);
 	using CopyObjectFn = void* (*)(void*);
-	using InvokeMethodFn = void (*)(void*, String, const void**, const ManagedType*, int32_t);
-	using InvokeMethodRetFn = void (*)(void*, String, const void**, const ManagedType*, int32_t, void*);
-	using InvokeStaticMethodFn = void (*)(TypeId, String, const void**, const ManagedType*, int32_t);
-	using InvokeStaticMethodRetFn = void (*)(TypeId, String, const void**, const ManagedType*, int32_t, void*);
-	using SetFieldValueFn = void (*)(void*, String, void*);
-	using GetFieldValueFn = void (*)(void*, String, void*);
-	using SetPropertyValueFn = void (*)(void*, String, void*);
-	using GetPropertyValueFn = void (*)(void*, String, void*);
+	using InvokeMethodFn = void (*)(void*, MemberName, const void**, const ManagedType*, int32_t);
+	using InvokeMethodRetFn = void (*)(void*, MemberName, const void**, const ManagedType*, int32_t, void*);
+	using InvokeStaticMethodFn = void (*)(TypeId, MemberName, const void**, const ManagedType*, int32_t);
+	using InvokeStaticMethodRetFn = void (*)(TypeId, MemberName, const void**, const ManagedType*, int32_t, void*);
+	using ResolveMethodFn = ManagedHandle (*)(TypeId, String, const ManagedType*, int32_t);
+	using InvokeMethodHandleFn = void (*)(void*, ManagedHandle, const void**, int32_t, void*);
+	using InvokeStaticMethodHandleFn = void (*)(ManagedHandle, const void**, int32_t, void*);
+	using InvokeMethodBatchFn = int32_t (*)(void* const*, int32_t, int32_t, ManagedHandle, const void**, int32_t, int32_t, Bool32*);
+	using GetFunctionPointerFn = void* (*)(TypeId, String, ManagedType, int32_t, const ManagedType*, const int32_t*, int32_t);
+	using SetCompiledInvokersEnabledFn = void (*)(Bool32);
+	using SetHandleTrackingEnabledFn = void (*)(Bool32);
+	using SetObjectIdentityEnabledFn = void (*)(Bool32);
+	using SetStringInterningEnabledFn = void (*)(Bool32, int32_t);
+	using GetStringInterningStatsFn = void (*)(StringInterningStats*);
+	using SetUserDataFn = void (*)(void*, void*, void*);
+	using GetUserDataFn = void* (*)(void*);
+	using ReleaseArrayPinFn = void (*)(void*);
+	using SetFieldValueFn = void (*)(void*, MemberName, void*);
+	using GetFieldValueFn = void (*)(void*, MemberName, void*);
+	using SetPropertyValueFn = void (*)(void*, MemberName, void*);
+	using GetPropertyValueFn = void (*)(void*, MemberName, void*);
+	using ResolveFieldFn = ManagedHandle (*)(TypeId, String);
+	using ResolvePropertyFn = ManagedHandle (*)(TypeId, String);
+	using SetFieldValueByHandleFn = void (*)(void*, ManagedHandle, void*);
+	using GetFieldValueByHandleFn = void (*)(void*, ManagedHandle, void*);
+	using SetPropertyValueByHandleFn = void (*)(void*, ManagedHandle, void*);
+	using GetPropertyValueByHandleFn = void (*)(void*, ManagedHandle, void*);
+	using CreateFieldSetFn = ManagedHandle (*)(TypeId, const ManagedHandle*, const int32_t*, int32_t, int32_t);
+	using ReadFieldsFn = void (*)(void*, ManagedHandle, void*);
+	using WriteFieldsFn = void (*)(void*, ManagedHandle, const void*);
+	using CreateWeakHandleFn = void* (*)(void*, Bool32);
+	using IsHandleAliveFn = Bool32 (*)(void*);
+	using LockWeakHandleFn = void* (*)(void*);
 	using DestroyObjectFn = void (*)(void*);
+	using CreateObjectRefFn = uint64_t (*)(void*, const Type*);
+	using ReleaseObjectRefFn = void (*)(uint64_t);
+	using IsObjectRefAliveFn = Bool32 (*)(uint64_t);
+	using LockObjectRefFn = void* (*)(uint64_t, const Type**);
+	using GetObjectRefTypeFn = const Type* (*)(uint64_t);
+	using InvokeObjectRefMethodFn = void (*)(uint64_t, ManagedHandle, const void**, int32_t, void*);
+	using InvokeMethodBatchRefsFn = int32_t (*)(const void*, int32_t, ManagedHandle, const void**, int32_t, int32_t, Bool32*);
+	using SetObjectRefFieldValueFn = void (*)(uint64_t, ManagedHandle, void*);
+	using GetObjectRefFieldValueFn = void (*)(uint64_t, ManagedHandle, void*);
+	using DestroyObjectsFn = void (*)(void* const*, int32_t);
 	using GetObjectTypeIdFn = void (*)(void*, int32_t*);
 
 	using CollectGarbageFn = void (*)(int32_t, GCCollectionMode, Bool32, Bool32);
 	using WaitForPendingFinalizersFn = void (*)();
+	using GetAllocatedBytesForCurrentThreadFn = int64_t (*)();
 
 	struct ManagedFunctions
 	{
@@ -153,21 +199,63 @@ namespace Coral {
 #pragma endregion
 
 		CreateObjectFn CreateObjectFptr = nullptr;
+		ResolveConstructorFn ResolveConstructorFptr = nullptr;
+		CreateObjectWithConstructorFn CreateObjectWithConstructorFptr = nullptr;
+		CreateObjectsFn CreateObjectsFptr = nullptr;
+		EnablePoolingFn EnablePoolingFptr = nullptr;
+		DisablePoolingFn DisablePoolingFptr = nullptr;
+		GetPoolStatsFn GetPoolStatsFptr = nullptr;
 		CopyObjectFn CopyObjectFptr = nullptr;
 		CreateAssemblyLoadContextFn CreateAssemblyLoadContextFptr = nullptr;
 		InvokeMethodFn InvokeMethodFptr = nullptr;
 		InvokeMethodRetFn InvokeMethodRetFptr = nullptr;
 		InvokeStaticMethodFn InvokeStaticMethodFptr = nullptr;
 		InvokeStaticMethodRetFn InvokeStaticMethodRetFptr = nullptr;
+		ResolveMethodFn ResolveMethodFptr = nullptr;
+		InvokeMethodHandleFn InvokeMethodHandleFptr = nullptr;
+		InvokeStaticMethodHandleFn InvokeStaticMethodHandleFptr = nullptr;
+		InvokeMethodBatchFn InvokeMethodBatchFptr = nullptr;
+		GetFunctionPointerFn GetFunctionPointerFptr = nullptr;
+		SetCompiledInvokersEnabledFn SetCompiledInvokersEnabledFptr = nullptr;
+		SetHandleTrackingEnabledFn SetHandleTrackingEnabledFptr = nullptr;
+		SetObjectIdentityEnabledFn SetObjectIdentityEnabledFptr = nullptr;
+		SetStringInterningEnabledFn SetStringInterningEnabledFptr = nullptr;
+		GetStringInterningStatsFn GetStringInterningStatsFptr = nullptr;
+		SetUserDataFn SetUserDataFptr = nullptr;
+		GetUserDataFn GetUserDataFptr = nullptr;
+		ReleaseArrayPinFn ReleaseArrayPinFptr = nullptr;
 		SetFieldValueFn SetFieldValueFptr = nullptr;
 		GetFieldValueFn GetFieldValueFptr = nullptr;
 		SetPropertyValueFn SetPropertyValueFptr = nullptr;
 		GetPropertyValueFn GetPropertyValueFptr = nullptr;
+		ResolveFieldFn ResolveFieldFptr = nullptr;
+		ResolvePropertyFn ResolvePropertyFptr = nullptr;
+		SetFieldValueByHandleFn SetFieldValueByHandleFptr = nullptr;
+		GetFieldValueByHandleFn GetFieldValueByHandleFptr = nullptr;
+		SetPropertyValueByHandleFn SetPropertyValueByHandleFptr = nullptr;
+		GetPropertyValueByHandleFn GetPropertyValueByHandleFptr = nullptr;
+		CreateFieldSetFn CreateFieldSetFptr = nullptr;
+		ReadFieldsFn ReadFieldsFptr = nullptr;
+		WriteFieldsFn WriteFieldsFptr = nullptr;
+		CreateWeakHandleFn CreateWeakHandleFptr = nullptr;
+		IsHandleAliveFn IsHandleAliveFptr = nullptr;
+		LockWeakHandleFn LockWeakHandleFptr = nullptr;
 		DestroyObjectFn DestroyObjectFptr = nullptr;
+		CreateObjectRefFn CreateObjectRefFptr = nullptr;
+		ReleaseObjectRefFn ReleaseObjectRefFptr = nullptr;
+		IsObjectRefAliveFn IsObjectRefAliveFptr = nullptr;
+		LockObjectRefFn LockObjectRefFptr = nullptr;
+		GetObjectRefTypeFn GetObjectRefTypeFptr = nullptr;
+		InvokeObjectRefMethodFn InvokeObjectRefMethodFptr = nullptr;
+		InvokeMethodBatchRefsFn InvokeMethodBatchRefsFptr = nullptr;
+		SetObjectRefFieldValueFn SetObjectRefFieldValueFptr = nullptr;
+		GetObjectRefFieldValueFn GetObjectRefFieldValueFptr = nullptr;
+		DestroyObjectsFn DestroyObjectsFptr = nullptr;
 		GetObjectTypeIdFn GetObjectTypeIdFptr = nullptr;
 
 		CollectGarbageFn CollectGarbageFptr = nullptr;
 		WaitForPendingFinalizersFn WaitForPendingFinalizersFptr = nullptr;
+		GetAllocatedBytesForCurrentThreadFn GetAllocatedBytesForCurrentThreadFptr = nullptr;
 	};
 
 	inline ManagedFunctions s_ManagedFunctions;
@@ -0,0 +1,71 @@
+#include "Coral/DestroyQueue.hpp"
+
+#include "CoralManagedFunctions.hpp"
+
+#include <atomic>
+
+namespace Coral {
+
+	struct DestroyQueueNode
+	{
+		void* Handle;
+		DestroyQueueNode* Next;
+	};
+
+	static std::atomic<bool> s_Enabled = false;
+
+	// Producers push onto the head, Flush takes the whole list at once so nodes are never popped individually
+	static std::atomic<DestroyQueueNode*> s_Head = nullptr;
+
+	static constexpr size_t s_FlushBatchSize = 1024;
+
+	void DestroyQueue::SetEnabled(bool InEnabled)
+	{
+		bool wasEnabled = s_Enabled.exchange(InEnabled, std::memory_order_relaxed);
+
+		if (wasEnabled && !InEnabled)
+			Flush();
+	}
+
+	bool DestroyQueue::IsEnabled()
+	{
+		return s_Enabled.load(std::memory_order_relaxed);
+	}
+
+	void DestroyQueue::Push(void* InHandle)
+	{
+		auto* node = new DestroyQueueNode{ InHandle, s_Head.load(std::memory_order_relaxed) };
+
+		while (!s_Head.compare_exchange_weak(node->Next, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+	}
+
+	size_t DestroyQueue::Flush()
+	{
+		auto* node = s_Head.exchange(nullptr, std::memory_order_acquire);
+
+		void* handles[s_FlushBatchSize];
+		size_t handleCount = 0;
+		size_t freedCount = 0;
+
+		while (node)
+		{
+			handles[handleCount++] = node->Handle;
+
+			auto* next = node->Next;
+			delete node;
+			node = next;
+
+			if (handleCount == s_FlushBatchSize || !node)
+			{
+				s_ManagedFunctions.DestroyObjectsFptr(handles, static_cast<int32_t>(handleCount));
+				freedCount += handleCount;
+				handleCount = 0;
+			}
+		}
+
+		return freedCount;
+	}
+
+}
@@ -43,4 +43,11 @@ namespace Coral {
 		return result;
 	}
 
+	FieldHandle FieldInfo::GetHandle() const
+	{
+		FieldHandle result;
+		result.m_Handle = m_Handle;
+		return result;
+	}
+
 }
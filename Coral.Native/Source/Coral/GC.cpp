@@ -18,5 +18,10 @@ namespace Coral {
 	{
 		s_ManagedFunctions.WaitForPendingFinalizersFptr();
 	}
+
+	int64_t GC::GetAllocatedBytesForCurrentThread()
+	{
+		return s_ManagedFunctions.GetAllocatedBytesForCurrentThreadFptr();
+	}
 	
 }
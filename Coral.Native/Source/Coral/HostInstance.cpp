@@ -1,6 +1,7 @@
 #include "Coral/HostInstance.hpp"
 #include "Coral/StringHelper.hpp"
 #include "Coral/TypeCache.hpp"
+#include "Coral/DestroyQueue.hpp"
 
 #include "Verify.hpp"
 #include "HostFXRErrorCodes.hpp"
@@ -94,6 +95,9 @@ namespace Coral {
 
 	void HostInstance::Shutdown()
 	{
+		// Handles still queued at this point would never be freed otherwise
+		DestroyQueue::Flush();
+
 		s_CoreCLRFunctions.CloseHostFXR(m_HostFXRContext);
 	}
 	
@@ -119,11 +123,41 @@ namespace Coral {
 
 	void HostInstance::UnloadAssemblyLoadContext(AssemblyLoadContext& InLoadContext)
 	{
+		// Queued handles may belong to the context, they have to be freed before it's unloaded
+		DestroyQueue::Flush();
+
 		s_ManagedFunctions.UnloadAssemblyLoadContextFptr(InLoadContext.m_ContextId);
 		InLoadContext.m_ContextId = -1;
 		InLoadContext.m_LoadedAssemblies.Clear();
 	}
 
+	void HostInstance::SetCompiledInvokersEnabled(bool InEnabled)
+	{
+		s_ManagedFunctions.SetCompiledInvokersEnabledFptr(InEnabled);
+	}
+
+	void HostInstance::SetHandleTrackingEnabled(bool InEnabled)
+	{
+		s_ManagedFunctions.SetHandleTrackingEnabledFptr(InEnabled);
+	}
+
+	void HostInstance::SetObjectIdentityEnabled(bool InEnabled)
+	{
+		s_ManagedFunctions.SetObjectIdentityEnabledFptr(InEnabled);
+	}
+
+	void HostInstance::SetStringInterningEnabled(bool InEnabled, int32_t InCapacity)
+	{
+		s_ManagedFunctions.SetStringInterningEnabledFptr(InEnabled, InCapacity);
+	}
+
+	StringInterningStats HostInstance::GetStringInterningStats() const
+	{
+		StringInterningStats result;
+		s_ManagedFunctions.GetStringInterningStatsFptr(&result);
+		return result;
+	}
+
 #ifdef CORAL_WINDOWS
 	template <typename TFunc>
 	TFunc LoadFunctionPtr(void* InLibraryHandle, const char* InFunctionName)
@@ -330,6 +364,9 @@ namespace Coral {
 		s_ManagedFunctions.GetTypeManagedTypeFptr = LoadCoralManagedFunctionPtr<GetTypeManagedTypeFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetTypeManagedType"));
 		s_ManagedFunctions.InvokeStaticMethodFptr = LoadCoralManagedFunctionPtr<InvokeStaticMethodFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeStaticMethod"));
 		s_ManagedFunctions.InvokeStaticMethodRetFptr = LoadCoralManagedFunctionPtr<InvokeStaticMethodRetFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeStaticMethodRet"));
+		s_ManagedFunctions.ResolveMethodFptr = LoadCoralManagedFunctionPtr<ResolveMethodFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolveMethod"));
+		s_ManagedFunctions.InvokeStaticMethodHandleFptr = LoadCoralManagedFunctionPtr<InvokeStaticMethodHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeStaticMethodHandle"));
+		s_ManagedFunctions.GetFunctionPointerFptr = LoadCoralManagedFunctionPtr<GetFunctionPointerFn>(CORAL_STR("Coral.Managed.FunctionPointers, Coral.Managed"), CORAL_STR("GetFunctionPointer"));
 
 		s_ManagedFunctions.GetMethodInfoNameFptr = LoadCoralManagedFunctionPtr<GetMethodInfoNameFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetMethodInfoName"));
 		s_ManagedFunctions.GetMethodInfoReturnTypeFptr = LoadCoralManagedFunctionPtr<GetMethodInfoReturnTypeFn>(CORAL_STR("Coral.Managed.TypeInterface, Coral.Managed"), CORAL_STR("GetMethodInfoReturnType"));
@@ -351,18 +388,57 @@ namespace Coral {
 
 		s_ManagedFunctions.SetInternalCallsFptr = LoadCoralManagedFunctionPtr<SetInternalCallsFn>(CORAL_STR("Coral.Managed.Interop.InternalCallsManager, Coral.Managed"), CORAL_STR("SetInternalCalls"));
 		s_ManagedFunctions.CreateObjectFptr = LoadCoralManagedFunctionPtr<CreateObjectFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CreateObject"));
+		s_ManagedFunctions.ResolveConstructorFptr = LoadCoralManagedFunctionPtr<ResolveConstructorFn>(CORAL_STR("Coral.Managed.ObjectFactories, Coral.Managed"), CORAL_STR("ResolveConstructor"));
+		s_ManagedFunctions.CreateObjectWithConstructorFptr = LoadCoralManagedFunctionPtr<CreateObjectWithConstructorFn>(CORAL_STR("Coral.Managed.ObjectFactories, Coral.Managed"), CORAL_STR("CreateObjectWithConstructor"));
+		s_ManagedFunctions.CreateObjectsFptr = LoadCoralManagedFunctionPtr<CreateObjectsFn>(CORAL_STR("Coral.Managed.ObjectFactories, Coral.Managed"), CORAL_STR("CreateObjects"));
+		s_ManagedFunctions.EnablePoolingFptr = LoadCoralManagedFunctionPtr<EnablePoolingFn>(CORAL_STR("Coral.Managed.ObjectPools, Coral.Managed"), CORAL_STR("EnablePooling"));
+		s_ManagedFunctions.DisablePoolingFptr = LoadCoralManagedFunctionPtr<DisablePoolingFn>(CORAL_STR("Coral.Managed.ObjectPools, Coral.Managed"), CORAL_STR("DisablePooling"));
+		s_ManagedFunctions.GetPoolStatsFptr = LoadCoralManagedFunctionPtr<GetPoolStatsFn>(CORAL_STR("Coral.Managed.ObjectPools, Coral.Managed"), CORAL_STR("GetPoolStats"));
 		s_ManagedFunctions.CopyObjectFptr = LoadCoralManagedFunctionPtr<CopyObjectFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CopyObject"));
 		s_ManagedFunctions.InvokeMethodFptr = LoadCoralManagedFunctionPtr<InvokeMethodFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethod"));
 		s_ManagedFunctions.InvokeMethodRetFptr = LoadCoralManagedFunctionPtr<InvokeMethodRetFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodRet"));
+		s_ManagedFunctions.InvokeMethodHandleFptr = LoadCoralManagedFunctionPtr<InvokeMethodHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodHandle"));
+		s_ManagedFunctions.InvokeMethodBatchFptr = LoadCoralManagedFunctionPtr<InvokeMethodBatchFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("InvokeMethodBatch"));
 		s_ManagedFunctions.SetFieldValueFptr = LoadCoralManagedFunctionPtr<SetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetFieldValue"));
 		s_ManagedFunctions.GetFieldValueFptr = LoadCoralManagedFunctionPtr<GetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetFieldValue"));
 		s_ManagedFunctions.SetPropertyValueFptr = LoadCoralManagedFunctionPtr<SetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetPropertyValue"));
 		s_ManagedFunctions.GetPropertyValueFptr = LoadCoralManagedFunctionPtr<GetFieldValueFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetPropertyValue"));
+		s_ManagedFunctions.ResolveFieldFptr = LoadCoralManagedFunctionPtr<ResolveFieldFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolveField"));
+		s_ManagedFunctions.ResolvePropertyFptr = LoadCoralManagedFunctionPtr<ResolvePropertyFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("ResolveProperty"));
+		s_ManagedFunctions.SetFieldValueByHandleFptr = LoadCoralManagedFunctionPtr<SetFieldValueByHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetFieldValueByHandle"));
+		s_ManagedFunctions.GetFieldValueByHandleFptr = LoadCoralManagedFunctionPtr<GetFieldValueByHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetFieldValueByHandle"));
+		s_ManagedFunctions.SetPropertyValueByHandleFptr = LoadCoralManagedFunctionPtr<SetPropertyValueByHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("SetPropertyValueByHandle"));
+		s_ManagedFunctions.GetPropertyValueByHandleFptr = LoadCoralManagedFunctionPtr<GetPropertyValueByHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetPropertyValueByHandle"));
+		s_ManagedFunctions.CreateFieldSetFptr = LoadCoralManagedFunctionPtr<CreateFieldSetFn>(CORAL_STR("Coral.Managed.FieldSets, Coral.Managed"), CORAL_STR("CreateFieldSet"));
+		s_ManagedFunctions.ReadFieldsFptr = LoadCoralManagedFunctionPtr<ReadFieldsFn>(CORAL_STR("Coral.Managed.FieldSets, Coral.Managed"), CORAL_STR("ReadFields"));
+		s_ManagedFunctions.WriteFieldsFptr = LoadCoralManagedFunctionPtr<WriteFieldsFn>(CORAL_STR("Coral.Managed.FieldSets, Coral.Managed"), CORAL_STR("WriteFields"));
+		s_ManagedFunctions.SetCompiledInvokersEnabledFptr = LoadCoralManagedFunctionPtr<SetCompiledInvokersEnabledFn>(CORAL_STR("Coral.Managed.MethodInvokers, Coral.Managed"), CORAL_STR("SetCompiledInvokersEnabled"));
+		s_ManagedFunctions.SetHandleTrackingEnabledFptr = LoadCoralManagedFunctionPtr<SetHandleTrackingEnabledFn>(CORAL_STR("Coral.Managed.HandleRegistry, Coral.Managed"), CORAL_STR("SetHandleTrackingEnabled"));
+		s_ManagedFunctions.SetObjectIdentityEnabledFptr = LoadCoralManagedFunctionPtr<SetObjectIdentityEnabledFn>(CORAL_STR("Coral.Managed.IdentityMap, Coral.Managed"), CORAL_STR("SetObjectIdentityEnabled"));
+		s_ManagedFunctions.SetStringInterningEnabledFptr = LoadCoralManagedFunctionPtr<SetStringInterningEnabledFn>(CORAL_STR("Coral.Managed.StringInterning, Coral.Managed"), CORAL_STR("SetStringInterningEnabled"));
+		s_ManagedFunctions.GetStringInterningStatsFptr = LoadCoralManagedFunctionPtr<GetStringInterningStatsFn>(CORAL_STR("Coral.Managed.StringInterning, Coral.Managed"), CORAL_STR("GetStringInterningStats"));
+		s_ManagedFunctions.SetUserDataFptr = LoadCoralManagedFunctionPtr<SetUserDataFn>(CORAL_STR("Coral.Managed.UserData, Coral.Managed"), CORAL_STR("SetUserData"));
+		s_ManagedFunctions.GetUserDataFptr = LoadCoralManagedFunctionPtr<GetUserDataFn>(CORAL_STR("Coral.Managed.UserData, Coral.Managed"), CORAL_STR("GetUserData"));
+		s_ManagedFunctions.ReleaseArrayPinFptr = LoadCoralManagedFunctionPtr<ReleaseArrayPinFn>(CORAL_STR("Coral.Managed.ArrayPins, Coral.Managed"), CORAL_STR("ReleaseArrayPin"));
+		s_ManagedFunctions.CreateWeakHandleFptr = LoadCoralManagedFunctionPtr<CreateWeakHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("CreateWeakHandle"));
+		s_ManagedFunctions.IsHandleAliveFptr = LoadCoralManagedFunctionPtr<IsHandleAliveFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("IsHandleAlive"));
+		s_ManagedFunctions.LockWeakHandleFptr = LoadCoralManagedFunctionPtr<LockWeakHandleFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("LockWeakHandle"));
 		s_ManagedFunctions.DestroyObjectFptr = LoadCoralManagedFunctionPtr<DestroyObjectFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("DestroyObject"));
+		s_ManagedFunctions.DestroyObjectsFptr = LoadCoralManagedFunctionPtr<DestroyObjectsFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("DestroyObjects"));
 		s_ManagedFunctions.GetObjectTypeIdFptr = LoadCoralManagedFunctionPtr<GetObjectTypeIdFn>(CORAL_STR("Coral.Managed.ManagedObject, Coral.Managed"), CORAL_STR("GetObjectTypeId"));
+		s_ManagedFunctions.CreateObjectRefFptr = LoadCoralManagedFunctionPtr<CreateObjectRefFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("CreateObjectRef"));
+		s_ManagedFunctions.ReleaseObjectRefFptr = LoadCoralManagedFunctionPtr<ReleaseObjectRefFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("ReleaseObjectRef"));
+		s_ManagedFunctions.IsObjectRefAliveFptr = LoadCoralManagedFunctionPtr<IsObjectRefAliveFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("IsObjectRefAlive"));
+		s_ManagedFunctions.LockObjectRefFptr = LoadCoralManagedFunctionPtr<LockObjectRefFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("LockObjectRef"));
+		s_ManagedFunctions.GetObjectRefTypeFptr = LoadCoralManagedFunctionPtr<GetObjectRefTypeFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("GetObjectRefType"));
+		s_ManagedFunctions.InvokeObjectRefMethodFptr = LoadCoralManagedFunctionPtr<InvokeObjectRefMethodFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("InvokeObjectRefMethod"));
+		s_ManagedFunctions.InvokeMethodBatchRefsFptr = LoadCoralManagedFunctionPtr<InvokeMethodBatchRefsFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("InvokeMethodBatchRefs"));
+		s_ManagedFunctions.SetObjectRefFieldValueFptr = LoadCoralManagedFunctionPtr<SetObjectRefFieldValueFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("SetObjectRefFieldValue"));
+		s_ManagedFunctions.GetObjectRefFieldValueFptr = LoadCoralManagedFunctionPtr<GetObjectRefFieldValueFn>(CORAL_STR("Coral.Managed.ObjectTable, Coral.Managed"), CORAL_STR("GetObjectRefFieldValue"));
 
 		s_ManagedFunctions.CollectGarbageFptr = LoadCoralManagedFunctionPtr<CollectGarbageFn>(CORAL_STR("Coral.Managed.GarbageCollector, Coral.Managed"), CORAL_STR("CollectGarbage"));
 		s_ManagedFunctions.WaitForPendingFinalizersFptr = LoadCoralManagedFunctionPtr<WaitForPendingFinalizersFn>(CORAL_STR("Coral.Managed.GarbageCollector, Coral.Managed"), CORAL_STR("WaitForPendingFinalizers"));
+		s_ManagedFunctions.GetAllocatedBytesForCurrentThreadFptr = LoadCoralManagedFunctionPtr<GetAllocatedBytesForCurrentThreadFn>(CORAL_STR("Coral.Managed.GarbageCollector, Coral.Managed"), CORAL_STR("GetAllocatedBytesForCurrentThread"));
 	}
 
 	void* HostInstance::LoadCoralManagedFunctionPtr(const std::filesystem::path& InAssemblyPath, const UCChar* InTypeName, const UCChar* InMethodName, const UCChar* InDelegateType) const
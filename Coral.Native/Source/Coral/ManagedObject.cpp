@@ -4,6 +4,7 @@
 #include "Coral/StringHelper.hpp"
 #include "Coral/Type.hpp"
 #include "Coral/TypeCache.hpp"
+#include "Coral/DestroyQueue.hpp"
 
 #include "CoralManagedFunctions.hpp"
 
@@ -57,50 +58,93 @@ namespace Coral {
 		return *this;
 	}
 
-	void ManagedObject::InvokeMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
+	void ManagedObject::InvokeMethodInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
 	{
 		// NOTE(Peter): If you get an exception in this function it's most likely because you're using a Native only debugger type in Visual Studio
 		//				and it's catching a C# exception even though it shouldn't. I recommend switching the debugger type to Mixed (.NET Core)
 		//				which should be the default for Hazelnut, or simply press "Continue" until it works.
 		//				This is a problem with the Visual Studio debugger and nothing we can change.
-		auto methodName = String::New(InMethodName);
-		s_ManagedFunctions.InvokeMethodFptr(m_Handle, methodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength));
-		String::Free(methodName);
+		s_ManagedFunctions.InvokeMethodFptr(m_Handle, InMethodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength));
 	}
 
-	void ManagedObject::InvokeMethodRetInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	void ManagedObject::InvokeMethodRetInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
 	{
-		auto methodName = String::New(InMethodName);
-		s_ManagedFunctions.InvokeMethodRetFptr(m_Handle, methodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength), InResultStorage);
-		String::Free(methodName);
+		s_ManagedFunctions.InvokeMethodRetFptr(m_Handle, InMethodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength), InResultStorage);
 	}
 
-	void ManagedObject::SetFieldValueRaw(std::string_view InFieldName, void* InValue) const
+	void ManagedObject::InvokeMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const
 	{
-		auto fieldName = String::New(InFieldName);
-		s_ManagedFunctions.SetFieldValueFptr(m_Handle, fieldName, InValue);
-		String::Free(fieldName);
+		s_ManagedFunctions.InvokeMethodHandleFptr(m_Handle, InMethod.m_Handle, InParameters, static_cast<int32_t>(InLength), InResultStorage);
 	}
 
-	void ManagedObject::GetFieldValueRaw(std::string_view InFieldName, void* OutValue) const
+	size_t ManagedObject::InvokeBatchRaw(const MethodHandle& InMethod, void* const* InObjectHandles, size_t InObjectStride, size_t InCount, const void** InParameters, size_t InParameterCount, size_t InParameterStride, Bool32* OutResults)
 	{
-		auto fieldName = String::New(InFieldName);
-		s_ManagedFunctions.GetFieldValueFptr(m_Handle, fieldName, OutValue);
-		String::Free(fieldName);
+		if (InCount == 0)
+			return 0;
+
+		int32_t failedCount = s_ManagedFunctions.InvokeMethodBatchFptr(InObjectHandles, static_cast<int32_t>(InObjectStride), static_cast<int32_t>(InCount), InMethod.m_Handle,
+			InParameters, static_cast<int32_t>(InParameterCount), static_cast<int32_t>(InParameterStride * sizeof(void*)), OutResults);
+		return static_cast<size_t>(failedCount);
+	}
+
+	void ManagedObject::SetFieldValueRaw(MemberName InFieldName, void* InValue) const
+	{
+		s_ManagedFunctions.SetFieldValueFptr(m_Handle, InFieldName, InValue);
 	}
 
-	void ManagedObject::SetPropertyValueRaw(std::string_view InPropertyName, void* InValue) const
+	void ManagedObject::GetFieldValueRaw(MemberName InFieldName, void* OutValue) const
 	{
-		auto propertyName = String::New(InPropertyName);
-		s_ManagedFunctions.SetPropertyValueFptr(m_Handle, propertyName, InValue);
-		String::Free(propertyName);
+		s_ManagedFunctions.GetFieldValueFptr(m_Handle, InFieldName, OutValue);
+	}
+
+	void ManagedObject::SetPropertyValueRaw(MemberName InPropertyName, void* InValue) const
+	{
+		s_ManagedFunctions.SetPropertyValueFptr(m_Handle, InPropertyName, InValue);
 	}
 	
-	void ManagedObject::GetPropertyValueRaw(std::string_view InPropertyName, void* OutValue) const
+	void ManagedObject::GetPropertyValueRaw(MemberName InPropertyName, void* OutValue) const
+	{
+		s_ManagedFunctions.GetPropertyValueFptr(m_Handle, InPropertyName, OutValue);
+	}
+
+	void ManagedObject::SetFieldValueRaw(const FieldHandle& InField, void* InValue) const
+	{
+		s_ManagedFunctions.SetFieldValueByHandleFptr(m_Handle, InField.m_Handle, InValue);
+	}
+
+	void ManagedObject::GetFieldValueRaw(const FieldHandle& InField, void* OutValue) const
+	{
+		s_ManagedFunctions.GetFieldValueByHandleFptr(m_Handle, InField.m_Handle, OutValue);
+	}
+
+	void ManagedObject::SetPropertyValueRaw(const PropertyHandle& InProperty, void* InValue) const
+	{
+		s_ManagedFunctions.SetPropertyValueByHandleFptr(m_Handle, InProperty.m_Handle, InValue);
+	}
+
+	void ManagedObject::GetPropertyValueRaw(const PropertyHandle& InProperty, void* OutValue) const
+	{
+		s_ManagedFunctions.GetPropertyValueByHandleFptr(m_Handle, InProperty.m_Handle, OutValue);
+	}
+
+	void ManagedObject::ReadFields(const FieldSet& InFieldSet, void* OutBuffer) const
+	{
+		s_ManagedFunctions.ReadFieldsFptr(m_Handle, InFieldSet.m_Handle, OutBuffer);
+	}
+
+	void ManagedObject::WriteFields(const FieldSet& InFieldSet, const void* InBuffer) const
+	{
+		s_ManagedFunctions.WriteFieldsFptr(m_Handle, InFieldSet.m_Handle, InBuffer);
+	}
+
+	void ManagedObject::SetUserData(void* InData, void (*InDeleter)(void*)) const
+	{
+		s_ManagedFunctions.SetUserDataFptr(m_Handle, InData, reinterpret_cast<void*>(InDeleter));
+	}
+
+	void* ManagedObject::GetUserData() const
 	{
-		auto propertyName = String::New(InPropertyName);
-		s_ManagedFunctions.GetPropertyValueFptr(m_Handle, propertyName, OutValue);
-		String::Free(propertyName);
+		return s_ManagedFunctions.GetUserDataFptr(m_Handle);
 	}
 
 	const Type& ManagedObject::GetType()
@@ -120,7 +164,10 @@ namespace Coral {
 		if (!m_Handle)
 			return;
 
-		s_ManagedFunctions.DestroyObjectFptr(m_Handle);
+		if (DestroyQueue::IsEnabled())
+			DestroyQueue::Push(m_Handle);
+		else
+			s_ManagedFunctions.DestroyObjectFptr(m_Handle);
 		m_Handle = nullptr;
 		m_Type = nullptr;
 	}
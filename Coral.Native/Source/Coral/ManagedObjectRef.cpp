@@ -0,0 +1,80 @@
+#include "Coral/ManagedObjectRef.hpp"
+#include "Coral/Type.hpp"
+
+#include "CoralManagedFunctions.hpp"
+
+namespace Coral {
+
+	ManagedObjectRef ManagedObjectRef::Create(const ManagedObject& InObject)
+	{
+		ManagedObjectRef result;
+
+		if (InObject.m_Handle)
+		{
+			uint64_t value = s_ManagedFunctions.CreateObjectRefFptr(InObject.m_Handle, InObject.m_Type);
+			result.m_Index = static_cast<uint32_t>(value);
+			result.m_Generation = static_cast<uint32_t>(value >> 32);
+		}
+
+		return result;
+	}
+
+	void ManagedObjectRef::Release()
+	{
+		if (!IsValid())
+			return;
+
+		s_ManagedFunctions.ReleaseObjectRefFptr(GetValue());
+		m_Index = 0;
+		m_Generation = 0;
+	}
+
+	bool ManagedObjectRef::IsAlive() const
+	{
+		return IsValid() && s_ManagedFunctions.IsObjectRefAliveFptr(GetValue());
+	}
+
+	ManagedObject ManagedObjectRef::Lock() const
+	{
+		ManagedObject result;
+
+		if (IsValid())
+			result.m_Handle = s_ManagedFunctions.LockObjectRefFptr(GetValue(), &result.m_Type);
+
+		return result;
+	}
+
+	const Type& ManagedObjectRef::GetType() const
+	{
+		static Type s_NullType;
+
+		const Type* type = IsValid() ? s_ManagedFunctions.GetObjectRefTypeFptr(GetValue()) : nullptr;
+		return type ? *type : s_NullType;
+	}
+
+	size_t ManagedObjectRef::InvokeBatchRaw(const MethodHandle& InMethod, const ManagedObjectRef* InObjects, size_t InCount, const void** InParameters, size_t InParameterCount, size_t InParameterStride, Bool32* OutResults)
+	{
+		if (InCount == 0)
+			return 0;
+
+		int32_t failedCount = s_ManagedFunctions.InvokeMethodBatchRefsFptr(InObjects, static_cast<int32_t>(InCount), InMethod.m_Handle,
+			InParameters, static_cast<int32_t>(InParameterCount), static_cast<int32_t>(InParameterStride * sizeof(void*)), OutResults);
+		return static_cast<size_t>(failedCount);
+	}
+
+	void ManagedObjectRef::SetFieldValueRaw(const FieldHandle& InField, void* InValue) const
+	{
+		s_ManagedFunctions.SetObjectRefFieldValueFptr(GetValue(), InField.m_Handle, InValue);
+	}
+
+	void ManagedObjectRef::GetFieldValueRaw(const FieldHandle& InField, void* OutValue) const
+	{
+		s_ManagedFunctions.GetObjectRefFieldValueFptr(GetValue(), InField.m_Handle, OutValue);
+	}
+
+	void ManagedObjectRef::InvokeMethodInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeObjectRefMethodFptr(GetValue(), InMethod.m_Handle, InParameters, static_cast<int32_t>(InLength), InResultStorage);
+	}
+
+}
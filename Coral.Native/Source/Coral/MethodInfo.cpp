@@ -67,4 +67,11 @@ namespace Coral {
 		return result;
 	}
 
+	MethodHandle MethodInfo::GetHandle() const
+	{
+		MethodHandle result;
+		result.m_Handle = m_Handle;
+		return result;
+	}
+
 }
@@ -39,4 +39,11 @@ namespace Coral {
 		return result;
 	}
 
+	PropertyHandle PropertyInfo::GetHandle() const
+	{
+		PropertyHandle result;
+		result.m_Handle = m_Handle;
+		return result;
+	}
+
 }
@@ -0,0 +1,70 @@
+#include "Coral/SharedManagedObject.hpp"
+
+namespace Coral {
+
+	SharedManagedObject::SharedManagedObject(ManagedObject&& InObject)
+	{
+		if (InObject.m_Handle)
+		{
+			m_Block = new ControlBlock();
+			m_Block->Object = std::move(InObject);
+		}
+	}
+
+	SharedManagedObject::SharedManagedObject(const SharedManagedObject& InOther)
+		: m_Block(InOther.m_Block)
+	{
+		if (m_Block)
+			m_Block->RefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	SharedManagedObject::SharedManagedObject(SharedManagedObject&& InOther) noexcept
+		: m_Block(InOther.m_Block)
+	{
+		InOther.m_Block = nullptr;
+	}
+
+	SharedManagedObject::~SharedManagedObject()
+	{
+		Reset();
+	}
+
+	SharedManagedObject& SharedManagedObject::operator=(const SharedManagedObject& InOther)
+	{
+		if (m_Block != InOther.m_Block)
+		{
+			if (InOther.m_Block)
+				InOther.m_Block->RefCount.fetch_add(1, std::memory_order_relaxed);
+
+			Reset();
+			m_Block = InOther.m_Block;
+		}
+
+		return *this;
+	}
+
+	SharedManagedObject& SharedManagedObject::operator=(SharedManagedObject&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Reset();
+			m_Block = InOther.m_Block;
+			InOther.m_Block = nullptr;
+		}
+
+		return *this;
+	}
+
+	void SharedManagedObject::Reset()
+	{
+		if (!m_Block)
+			return;
+
+		// The last copy frees the managed handle, ~ManagedObject does the transition
+		if (m_Block->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete m_Block;
+
+		m_Block = nullptr;
+	}
+
+}
@@ -161,6 +161,64 @@ namespace Coral {
 		return m_Id == InOther.m_Id;
 	}
 
+	MethodHandle Type::GetMethodHandle(std::string_view InMethodName, const ManagedType* InParameterTypes, size_t InParameterCount) const
+	{
+		auto methodName = String::New(InMethodName);
+		MethodHandle result;
+		result.m_Handle = s_ManagedFunctions.ResolveMethodFptr(m_Id, methodName, InParameterTypes, static_cast<int32_t>(InParameterCount));
+		String::Free(methodName);
+		return result;
+	}
+
+	ConstructorHandle Type::GetConstructorHandle(const ManagedType* InParameterTypes, size_t InParameterCount) const
+	{
+		ConstructorHandle result;
+		result.m_Handle = s_ManagedFunctions.ResolveConstructorFptr(m_Id, InParameterTypes, static_cast<int32_t>(InParameterCount));
+		return result;
+	}
+
+	FieldHandle Type::GetFieldHandle(std::string_view InFieldName) const
+	{
+		auto fieldName = String::New(InFieldName);
+		FieldHandle result;
+		result.m_Handle = s_ManagedFunctions.ResolveFieldFptr(m_Id, fieldName);
+		String::Free(fieldName);
+		return result;
+	}
+
+	PropertyHandle Type::GetPropertyHandle(std::string_view InPropertyName) const
+	{
+		auto propertyName = String::New(InPropertyName);
+		PropertyHandle result;
+		result.m_Handle = s_ManagedFunctions.ResolvePropertyFptr(m_Id, propertyName);
+		String::Free(propertyName);
+		return result;
+	}
+
+	FieldSet Type::CreateFieldSet(const std::vector<FieldBinding>& InBindings, size_t InBufferSize) const
+	{
+		std::vector<ManagedHandle> fields(InBindings.size());
+		std::vector<int32_t> offsets(InBindings.size());
+
+		for (size_t i = 0; i < InBindings.size(); i++)
+		{
+			fields[i] = InBindings[i].Field.m_Handle;
+			offsets[i] = static_cast<int32_t>(InBindings[i].Offset);
+		}
+
+		FieldSet result;
+		result.m_Handle = s_ManagedFunctions.CreateFieldSetFptr(m_Id, fields.data(), offsets.data(), static_cast<int32_t>(InBindings.size()), static_cast<int32_t>(InBufferSize));
+		return result;
+	}
+
+	void* Type::GetFunctionPointerInternal(std::string_view InMethodName, ManagedType InReturnType, int32_t InReturnSize, const ManagedType* InParameterTypes, const int32_t* InParameterSizes, size_t InParameterCount) const
+	{
+		auto methodName = String::New(InMethodName);
+		void* result = s_ManagedFunctions.GetFunctionPointerFptr(m_Id, methodName, InReturnType, InReturnSize, InParameterTypes, InParameterSizes, static_cast<int32_t>(InParameterCount));
+		String::Free(methodName);
+		return result;
+	}
+
 	ManagedObject Type::CreateInstanceInternal(const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
 	{
 		ManagedObject result;
@@ -169,18 +227,65 @@ namespace Coral {
 		return result;
 	}
 
-	void Type::InvokeStaticMethodInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
+	ManagedObject Type::CreateInstanceHandleInternal(const ConstructorHandle& InConstructor, const void** InParameters, size_t InLength) const
 	{
-		auto methodName = String::New(InMethodName);
-		s_ManagedFunctions.InvokeStaticMethodFptr(m_Id, methodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength));
-		String::Free(methodName);
+		ManagedObject result;
+		result.m_Handle = s_ManagedFunctions.CreateObjectWithConstructorFptr(m_Id, InConstructor.m_Handle, false, InParameters, static_cast<int32_t>(InLength));
+		result.m_Type = this;
+		return result;
 	}
 
-	void Type::InvokeStaticMethodRetInternal(std::string_view InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	size_t Type::CreateInstancesRaw(const ConstructorHandle& InConstructor, ManagedObject* OutObjects, size_t InCount, const void** InParameters, size_t InParameterCount, size_t InParameterStride) const
 	{
-		auto methodName = String::New(InMethodName);
-		s_ManagedFunctions.InvokeStaticMethodRetFptr(m_Id, methodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength), InResultStorage);
-		String::Free(methodName);
+		if (InCount == 0)
+			return 0;
+
+		for (size_t i = 0; i < InCount; i++)
+			OutObjects[i].Destroy();
+
+		// Managed code writes the handles straight into OutObjects
+		int32_t createdCount = s_ManagedFunctions.CreateObjectsFptr(m_Id, InConstructor.m_Handle, &OutObjects->m_Handle, static_cast<int32_t>(sizeof(ManagedObject)), static_cast<int32_t>(InCount),
+			InParameters, static_cast<int32_t>(InParameterCount), static_cast<int32_t>(InParameterStride * sizeof(void*)));
+
+		for (size_t i = 0; i < InCount; i++)
+		{
+			if (OutObjects[i].m_Handle)
+				OutObjects[i].m_Type = this;
+		}
+
+		return static_cast<size_t>(createdCount);
+	}
+
+	void Type::EnablePooling(int32_t InCapacity) const
+	{
+		s_ManagedFunctions.EnablePoolingFptr(m_Id, InCapacity);
+	}
+
+	void Type::DisablePooling() const
+	{
+		s_ManagedFunctions.DisablePoolingFptr(m_Id);
+	}
+
+	PoolStats Type::GetPoolStats() const
+	{
+		PoolStats result;
+		s_ManagedFunctions.GetPoolStatsFptr(m_Id, &result);
+		return result;
+	}
+
+	void Type::InvokeStaticMethodInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength) const
+	{
+		s_ManagedFunctions.InvokeStaticMethodFptr(m_Id, InMethodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength));
+	}
+
+	void Type::InvokeStaticMethodRetInternal(MemberName InMethodName, const void** InParameters, const ManagedType* InParameterTypes, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeStaticMethodRetFptr(m_Id, InMethodName, InParameters, InParameterTypes, static_cast<int32_t>(InLength), InResultStorage);
+	}
+
+	void Type::InvokeStaticMethodHandleInternal(const MethodHandle& InMethod, const void** InParameters, size_t InLength, void* InResultStorage) const
+	{
+		s_ManagedFunctions.InvokeStaticMethodHandleFptr(InMethod.m_Handle, InParameters, static_cast<int32_t>(InLength), InResultStorage);
 	}
 
 
@@ -11,14 +11,31 @@ namespace Coral {
 
 	Type* TypeCache::CacheType(Type&& InType)
 	{
+		std::scoped_lock lock(m_Mutex);
+
+		if (auto it = m_IDCache.find(InType.GetTypeId()); it != m_IDCache.end())
+			return it->second;
+
 		Type* type = &m_Types.Insert(std::move(InType)).second;
-		m_NameCache[type->GetFullName()] = type;
 		m_IDCache[type->GetTypeId()] = type;
+		m_UnnamedTypes.push_back(type);
 		return type;
 	}
 
+	void TypeCache::CacheNames() const
+	{
+		for (auto* type : m_UnnamedTypes)
+			m_NameCache[type->GetFullName()] = type;
+
+		m_UnnamedTypes.clear();
+	}
+
 	Type* TypeCache::GetTypeByName(std::string_view InName) const
 	{
+		std::scoped_lock lock(m_Mutex);
+
+		CacheNames();
+
 		auto name = std::string(InName);
 		auto it = m_NameCache.find(name);
 		return it != m_NameCache.end() ? it->second : nullptr;
@@ -26,15 +43,20 @@ namespace Coral {
 
 	Type* TypeCache::GetTypeByID(TypeId InTypeID) const
 	{
+		std::scoped_lock lock(m_Mutex);
+
 		auto it = m_IDCache.find(InTypeID);
 		return it != m_IDCache.end() ? it->second : nullptr;
 	}
 
 	void TypeCache::Clear()
 	{
+		std::scoped_lock lock(m_Mutex);
+
 		m_Types.Clear();
 		m_NameCache.clear();
 		m_IDCache.clear();
+		m_UnnamedTypes.clear();
 	}
 
 }
@@ -0,0 +1,98 @@
+#include "Coral/WeakManagedObject.hpp"
+#include "Coral/DestroyQueue.hpp"
+
+#include "CoralManagedFunctions.hpp"
+
+namespace Coral {
+
+	WeakManagedObject::WeakManagedObject(const ManagedObject& InObject, bool InTrackResurrection)
+		: m_Type(InObject.m_Type), m_TrackResurrection(InTrackResurrection)
+	{
+		if (InObject.m_Handle)
+			m_Handle = s_ManagedFunctions.CreateWeakHandleFptr(InObject.m_Handle, InTrackResurrection);
+	}
+
+	WeakManagedObject::WeakManagedObject(const WeakManagedObject& InOther)
+		: m_Type(InOther.m_Type), m_TrackResurrection(InOther.m_TrackResurrection)
+	{
+		if (InOther.m_Handle)
+			m_Handle = s_ManagedFunctions.CreateWeakHandleFptr(InOther.m_Handle, InOther.m_TrackResurrection);
+	}
+
+	WeakManagedObject::WeakManagedObject(WeakManagedObject&& InOther) noexcept
+		: m_Handle(InOther.m_Handle), m_Type(InOther.m_Type), m_TrackResurrection(InOther.m_TrackResurrection)
+	{
+		InOther.m_Handle = nullptr;
+		InOther.m_Type = nullptr;
+	}
+
+	WeakManagedObject::~WeakManagedObject()
+	{
+		Destroy();
+	}
+
+	WeakManagedObject& WeakManagedObject::operator=(const WeakManagedObject& InOther)
+	{
+		if (this != &InOther)
+		{
+			Destroy();
+
+			m_Type = InOther.m_Type;
+			m_TrackResurrection = InOther.m_TrackResurrection;
+
+			if (InOther.m_Handle)
+				m_Handle = s_ManagedFunctions.CreateWeakHandleFptr(InOther.m_Handle, InOther.m_TrackResurrection);
+		}
+
+		return *this;
+	}
+
+	WeakManagedObject& WeakManagedObject::operator=(WeakManagedObject&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Destroy();
+
+			m_Handle = InOther.m_Handle;
+			m_Type = InOther.m_Type;
+			m_TrackResurrection = InOther.m_TrackResurrection;
+			InOther.m_Handle = nullptr;
+			InOther.m_Type = nullptr;
+		}
+
+		return *this;
+	}
+
+	bool WeakManagedObject::IsAlive() const
+	{
+		return m_Handle && s_ManagedFunctions.IsHandleAliveFptr(m_Handle);
+	}
+
+	ManagedObject WeakManagedObject::TryLock() const
+	{
+		ManagedObject result;
+
+		if (m_Handle)
+		{
+			result.m_Handle = s_ManagedFunctions.LockWeakHandleFptr(m_Handle);
+			result.m_Type = result.m_Handle ? m_Type : nullptr;
+		}
+
+		return result;
+	}
+
+	void WeakManagedObject::Destroy()
+	{
+		if (!m_Handle)
+			return;
+
+		if (DestroyQueue::IsEnabled())
+			DestroyQueue::Push(m_Handle);
+		else
+			s_ManagedFunctions.DestroyObjectFptr(m_Handle);
+
+		m_Handle = nullptr;
+		m_Type = nullptr;
+	}
+
+}
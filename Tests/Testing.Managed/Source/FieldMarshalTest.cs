@@ -29,6 +29,7 @@ public class FieldMarshalTest
 	public double DoubleFieldTest = 10.0;
 	public bool BoolFieldTest = false;
 	public string StringFieldTest = "Hello";
+	public IntPtr IntPtrFieldTest;
 	public DummyClass? DummyClassTest; // NOTE(Emily): Set from native code.
 	public DummyStruct DummyStructTest;
 
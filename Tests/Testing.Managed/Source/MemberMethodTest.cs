@@ -1,6 +1,8 @@
 ﻿using System;
 using System.Runtime.InteropServices;
 
+using Coral.Managed.Interop;
+
 namespace Testing.Managed;
 
 [AttributeUsage(AttributeTargets.Method | AttributeTargets.Field | AttributeTargets.Property)]
@@ -97,6 +99,56 @@ public class MemberMethodTest
 		return InValue;
 	}
 
+	private string? m_LastString;
+
+	// Whether InValue is the same instance as the string passed in the previous call
+	public bool SameStringInstanceTest(string InValue)
+	{
+		bool result = ReferenceEquals(InValue, m_LastString);
+		m_LastString = InValue;
+		return result;
+	}
+
+	public float ArraySumTest(float[] InValues)
+	{
+		float result = 0.0f;
+
+		foreach (var value in InValues)
+			result += value;
+
+		return result;
+	}
+
+	public int StructArraySumTest(DummyStruct[] InValues)
+	{
+		int result = 0;
+
+		foreach (var value in InValues)
+			result += value.X + value.Z;
+
+		return result;
+	}
+
+	public int ObjectArraySumTest(MemberMethodTest?[] InObjects)
+	{
+		int result = 0;
+
+		foreach (var obj in InObjects)
+			result += obj?.Counter ?? 0;
+
+		return result;
+	}
+
+	public int StringViewTest(NativeStringView InValue)
+	{
+		return InValue.Equals("Hello, World!"u8) && InValue.ToString() == "Hello, World!" ? InValue.Length : -1;
+	}
+
+	public int StringViewLengthTest(NativeStringView InValue)
+	{
+		return InValue.Length;
+	}
+
 	public DummyStruct DummyStructTest(DummyStruct InValue)
 	{
 		InValue.X *= 2;
@@ -115,6 +167,34 @@ public class MemberMethodTest
 		return InValue + 10.0f;
 	}
 
+	public static int StaticIntTest(int InValue)
+	{
+		return InValue * 3;
+	}
+
+	[UnmanagedCallersOnly]
+	public static int UnmanagedAddTest(int InA, int InB)
+	{
+		return InA + InB;
+	}
+
+	public static float ThunkMultiplyTest(float InA, float InB)
+	{
+		return InA * InB;
+	}
+
+	public static DummyStruct ThunkStructTest(DummyStruct InValue, bool InDouble)
+	{
+		if (InDouble)
+		{
+			InValue.X *= 2;
+			InValue.Y *= 2.0f;
+			InValue.Z *= 2;
+		}
+
+		return InValue;
+	}
+
 	public unsafe DummyStruct* DummyStructPtrTest(DummyStruct* InValue)
 	{
 		InValue->X *= 2;
@@ -123,7 +203,40 @@ public class MemberMethodTest
 		return InValue;
 	}
 
+	// Only called from MultiThreadedInvokeTest, so they're resolved for the first time by several threads at once
+	public int ThreadedIntTest(int InValue) => InValue * 2;
+	public long ThreadedLongTest(long InValue) => InValue * 2;
+	public double ThreadedDoubleTest(double InValue) => InValue * 2.0;
+	public short ThreadedShortTest(short InValue) => (short)(InValue * 2);
+
+	public int Counter;
+
+	public MemberMethodTest() {}
+
+	public MemberMethodTest(int InCounter)
+	{
+		Counter = InCounter;
+	}
+
+	public void AddCounterTest(int InValue)
+	{
+		if (InValue < 0)
+			throw new ArgumentOutOfRangeException(nameof(InValue));
+
+		Counter += InValue;
+	}
+
 	[Dummy(SomeValue = 10.0f)]
 	public void SomeFunction(){}
 
-}
\ No newline at end of file
+}
+
+public class PooledObjectTest : Coral.Managed.IPoolable
+{
+	public int Counter;
+
+	public void Reset()
+	{
+		Counter = 0;
+	}
+}
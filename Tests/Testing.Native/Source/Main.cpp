@@ -5,12 +5,20 @@
 #include <chrono>
 #include <functional>
 #include <ranges>
+#include <thread>
+#include <atomic>
+#include <cmath>
 
 #include <Coral/HostInstance.hpp>
 #include <Coral/DotnetServices.hpp>
 #include <Coral/GC.hpp>
 #include <Coral/Array.hpp>
+#include <Coral/ArrayView.hpp>
 #include <Coral/Attribute.hpp>
+#include <Coral/SharedManagedObject.hpp>
+#include <Coral/DestroyQueue.hpp>
+#include <Coral/WeakManagedObject.hpp>
+#include <Coral/ManagedObjectRef.hpp>
 
 static Coral::Type g_TestsType;
 
@@ -148,6 +156,24 @@ static void RegisterMemberMethodTests(Coral::ManagedObject& InObject)
 		Coral::ScopedString str = InObject.InvokeMethod<Coral::String, Coral::String>("StringTest", Coral::String::New("Hello"));
 		return str == "Hello, World!";
 	});
+	RegisterTest("StringViewTest", [&InObject]() mutable
+	{
+		// Not null terminated, the length is passed along with the characters
+		std::string_view text = "Hello, World! Goodbye";
+		auto method = InObject.GetType().GetMethodHandle<Coral::Utf8StringView>("StringViewTest");
+
+		return InObject.InvokeMethod<int32_t, Coral::Utf8StringView>("StringViewTest", text.substr(0, 13)) == 13 &&
+			InObject.InvokeMethod<int32_t>(method, Coral::Utf8StringView(text.substr(0, 13))) == 13;
+	});
+	RegisterTest("StdStringViewTest", [&InObject]() mutable
+	{
+		std::string_view text = "Hello, World! Goodbye";
+		auto method = InObject.GetType().GetMethodHandle<std::string_view>("StringViewLengthTest");
+
+		return method.IsValid() && InObject.InvokeMethod<int32_t>("StringViewTest", text.substr(0, 13)) == 13 &&
+			InObject.InvokeMethod<int32_t>("StringViewLengthTest", text.substr(0, 5)) == 5 &&
+			InObject.InvokeMethod<int32_t>(method, text) == 21;
+	});
 	
 	RegisterTest("DummyStructTest", [&InObject]() mutable
 	{
@@ -183,6 +209,715 @@ static void RegisterMemberMethodTests(Coral::ManagedObject& InObject)
 	});
 }
 
+static void RegisterMethodHandleTests(Coral::ManagedObject& InObject)
+{
+	const auto& type = InObject.GetType();
+
+	RegisterTest("IntMethodHandleTest", [&InObject, &type]() mutable
+	{
+		auto method = type.GetMethodHandle<int32_t>("IntTest");
+		return method.IsValid() && InObject.InvokeMethod<int32_t, int32_t>(method, 10) == 20 && InObject.InvokeMethod<int32_t, int32_t>(method, 50) == 100;
+	});
+	RegisterTest("FloatMethodHandleTest", [&InObject, &type]() mutable
+	{
+		auto method = type.GetMethodHandle<float>("FloatTest");
+		return method.IsValid() && std::abs(InObject.InvokeMethod<float, float>(method, 10.0f) - 20.0f) < 0.001f;
+	});
+	RegisterTest("OverloadMethodHandleTest", [&InObject, &type]() mutable
+	{
+		auto intOverload = type.GetMethodHandle<int32_t>("OverloadTest");
+		auto floatOverload = type.GetMethodHandle<float>("OverloadTest");
+		return intOverload != floatOverload && InObject.InvokeMethod<int32_t, int32_t>(intOverload, 50) == 1050 && InObject.InvokeMethod<float, float>(floatOverload, 5.0f) == 15.0f;
+	});
+	RegisterTest("StaticMethodHandleTest", [&type]() mutable
+	{
+		auto method = type.GetMethodHandle<int32_t>("StaticIntTest");
+		return method.IsValid() && type.InvokeStaticMethod<int32_t, int32_t>(method, 10) == 30;
+	});
+}
+
+static void RegisterInvokeBatchTests(Coral::Type& InType)
+{
+	RegisterTest("SharedInvokeBatchTest", [&InType]() mutable
+	{
+		std::vector<Coral::ManagedObject> objects;
+		for (int32_t i = 0; i < 8; i++)
+			objects.push_back(InType.CreateInstance());
+
+		auto method = InType.GetMethodHandle<int32_t>("AddCounterTest");
+		if (Coral::ManagedObject::InvokeBatch<int32_t>(method, objects.data(), objects.size(), nullptr, 5) != 0)
+			return false;
+
+		for (const auto& object : objects)
+		{
+			if (object.GetFieldValue<int32_t>("Counter") != 5)
+				return false;
+		}
+
+		return true;
+	});
+	RegisterTest("PerObjectInvokeBatchTest", [&InType]() mutable
+	{
+		std::vector<Coral::ManagedObject> objects;
+		for (int32_t i = 0; i < 4; i++)
+			objects.push_back(InType.CreateInstance());
+
+		// The third call throws, which should only fail that call
+		int32_t values[] = { 1, 2, -1, 4 };
+		const void* parameters[] = { &values[0], &values[1], &values[2], &values[3] };
+		Coral::Bool32 results[4] = {};
+
+		auto method = InType.GetMethodHandle<int32_t>("AddCounterTest");
+		size_t failedCount = Coral::ManagedObject::InvokeBatchRaw(method, &objects[0].m_Handle, sizeof(Coral::ManagedObject), objects.size(), parameters, 1, 1, results);
+
+		return failedCount == 1 && results[0] && results[1] && !results[2] && results[3] &&
+			objects[1].GetFieldValue<int32_t>("Counter") == 2 && objects[3].GetFieldValue<int32_t>("Counter") == 4;
+	});
+}
+
+static void RegisterConstructorHandleTests(Coral::Type& InType)
+{
+	RegisterTest("DefaultConstructorHandleTest", [&InType]() mutable
+	{
+		auto constructor = InType.GetConstructorHandle();
+		if (!constructor.IsValid())
+			return false;
+
+		auto object = InType.CreateInstance(constructor);
+		bool result = object.GetFieldValue<int32_t>("Counter") == 0;
+		object.Destroy();
+		return result;
+	});
+	RegisterTest("ConstructorHandleTest", [&InType]() mutable
+	{
+		auto constructor = InType.GetConstructorHandle<int32_t>();
+		if (!constructor.IsValid())
+			return false;
+
+		auto object = InType.CreateInstance(constructor, 42);
+		bool result = object.GetFieldValue<int32_t>("Counter") == 42;
+		object.Destroy();
+		return result;
+	});
+	RegisterTest("ConstructorSignatureTest", [&InType]() mutable
+	{
+		auto object = InType.CreateInstance(7);
+		bool result = object.GetFieldValue<int32_t>("Counter") == 7;
+		object.Destroy();
+		return result;
+	});
+}
+
+static void RegisterCreateInstancesTests(Coral::Type& InType, Coral::Type& InOtherType)
+{
+	RegisterTest("CreateInstancesTest", [&InType]() mutable
+	{
+		std::vector<Coral::ManagedObject> objects(64);
+		if (InType.CreateInstances(objects.data(), objects.size(), 9) != objects.size())
+			return false;
+
+		for (const auto& object : objects)
+		{
+			if (!object.IsValid() || object.GetFieldValue<int32_t>("Counter") != 9)
+				return false;
+		}
+
+		return objects[0].m_Handle != objects[1].m_Handle;
+	});
+	RegisterTest("PerInstanceCreateInstancesTest", [&InType]() mutable
+	{
+		int32_t values[] = { 1, 2, 3, 4 };
+		const void* parameters[] = { &values[0], &values[1], &values[2], &values[3] };
+		Coral::ManagedObject objects[4];
+
+		auto constructor = InType.GetConstructorHandle<int32_t>();
+		if (InType.CreateInstancesRaw(constructor, objects, 4, parameters, 1, 1) != 4)
+			return false;
+
+		for (int32_t i = 0; i < 4; i++)
+		{
+			if (objects[i].GetFieldValue<int32_t>("Counter") != values[i])
+				return false;
+		}
+
+		return true;
+	});
+	RegisterTest("ForeignConstructorCreateInstancesTest", [&InType, &InOtherType]() mutable
+	{
+		// A constructor resolved on another type creates nothing instead of objects with the wrong Type
+		auto constructor = InOtherType.GetConstructorHandle();
+		Coral::ManagedObject objects[2];
+
+		auto object = InType.CreateInstance(constructor);
+		return InType.CreateInstances(constructor, objects, 2) == 0 && !objects[0].IsValid() && !object.IsValid();
+	});
+}
+
+static void RegisterSharedObjectTests(Coral::Type& InType)
+{
+	RegisterTest("SharedObjectCopyTest", [&InType]() mutable
+	{
+		Coral::SharedManagedObject shared(InType.CreateInstance());
+		if (!shared.IsValid())
+			return false;
+
+		{
+			std::vector<Coral::SharedManagedObject> copies(16, shared);
+			if (shared.GetRefCount() != 17 || copies[3]->m_Handle != shared->m_Handle)
+				return false;
+
+			copies[7]->InvokeMethod("AddCounterTest", 3);
+		}
+
+		return shared.GetRefCount() == 1 && shared->GetFieldValue<int32_t>("Counter") == 3;
+	});
+	RegisterTest("SharedObjectResetTest", [&InType]() mutable
+	{
+		Coral::SharedManagedObject shared(InType.CreateInstance());
+		Coral::SharedManagedObject copy = shared;
+		shared.Reset();
+
+		return !shared.IsValid() && copy.IsValid() && copy.GetRefCount() == 1 && copy->GetFieldValue<int32_t>("Counter") == 0;
+	});
+}
+
+static void RegisterDestroyQueueTests(Coral::Type& InType)
+{
+	RegisterTest("DeferredDestroyTest", [&InType]() mutable
+	{
+		Coral::DestroyQueue::SetEnabled(true);
+
+		std::vector<std::thread> threads;
+		for (int32_t i = 0; i < 4; i++)
+		{
+			threads.emplace_back([&InType]()
+			{
+				for (int32_t j = 0; j < 64; j++)
+					InType.CreateInstance().Destroy();
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		size_t freedCount = Coral::DestroyQueue::Flush();
+		Coral::DestroyQueue::SetEnabled(false);
+
+		return freedCount == 256 && Coral::DestroyQueue::Flush() == 0;
+	});
+	RegisterTest("DisableDestroyQueueTest", [&InType]() mutable
+	{
+		Coral::DestroyQueue::SetEnabled(true);
+
+		for (int32_t i = 0; i < 8; i++)
+			InType.CreateInstance().Destroy();
+
+		// Disabling the queue frees whatever is still in it
+		Coral::DestroyQueue::SetEnabled(false);
+		return Coral::DestroyQueue::Flush() == 0;
+	});
+}
+
+static void RegisterWeakObjectTests(Coral::Type& InType)
+{
+	RegisterTest("WeakObjectTest", [&InType]() mutable
+	{
+		auto object = InType.CreateInstance();
+		object.SetFieldValue<int32_t>("Counter", 12);
+
+		Coral::WeakManagedObject weak(object);
+		if (!weak.IsAlive())
+			return false;
+
+		auto locked = weak.TryLock();
+		return locked.IsValid() && locked.GetFieldValue<int32_t>("Counter") == 12;
+	});
+	RegisterTest("CollectedWeakObjectTest", [&InType]() mutable
+	{
+		auto object = InType.CreateInstance();
+		Coral::WeakManagedObject weak(object);
+		Coral::WeakManagedObject copy = weak;
+		object.Destroy();
+
+		Coral::GC::Collect();
+		Coral::GC::WaitForPendingFinalizers();
+
+		return weak.IsValid() && !weak.IsAlive() && !weak.TryLock().IsValid() && !copy.IsAlive();
+	});
+}
+
+static void RegisterObjectRefTests(Coral::Type& InType, Coral::Type& InFieldType)
+{
+	RegisterTest("ObjectRefTest", [&InType]() mutable
+	{
+		auto object = InType.CreateInstance();
+		auto ref = Coral::ManagedObjectRef::Create(object);
+		object.Destroy();
+
+		auto method = InType.GetMethodHandle<int32_t>("AddCounterTest");
+		auto field = InType.GetFieldHandle("Counter");
+
+		ref.InvokeMethod(method, 4);
+		ref.SetFieldValue<int32_t>(field, ref.GetFieldValue<int32_t>(field) + 1);
+
+		auto locked = ref.Lock();
+		bool result = ref.IsAlive() && &ref.GetType() == &InType && locked.GetFieldValue<int32_t>("Counter") == 5;
+		locked.Destroy();
+
+		ref.Release();
+		return result && !ref.IsAlive();
+	});
+	RegisterTest("ObjectRefBatchTest", [&InType]() mutable
+	{
+		std::vector<Coral::ManagedObjectRef> refs;
+		for (int32_t i = 0; i < 32; i++)
+		{
+			auto object = InType.CreateInstance();
+			refs.push_back(Coral::ManagedObjectRef::Create(object));
+			object.Destroy();
+		}
+
+		auto method = InType.GetMethodHandle<int32_t>("AddCounterTest");
+		auto field = InType.GetFieldHandle("Counter");
+		bool result = Coral::ManagedObjectRef::InvokeBatch<int32_t>(method, refs.data(), refs.size(), nullptr, 2) == 0;
+
+		// Release resets the ref it's called on, the copy keeps the old index and generation
+		auto stale = refs.back();
+
+		for (auto& ref : refs)
+		{
+			result = result && ref.GetFieldValue<int32_t>(field) == 2;
+			ref.Release();
+		}
+
+		// Released slots are reused with a new generation, the old refs stay invalid
+		auto object = InType.CreateInstance();
+		auto reused = Coral::ManagedObjectRef::Create(object);
+		object.Destroy();
+
+		result = result && reused.GetIndex() == stale.GetIndex() && reused.GetGeneration() != stale.GetGeneration();
+		result = result && reused.IsAlive() && !stale.IsAlive() && !stale.Lock().IsValid();
+		reused.Release();
+		return result;
+	});
+	RegisterTest("ObjectRefFieldMarshalTest", [&InFieldType]() mutable
+	{
+		auto object = InFieldType.CreateInstance();
+		auto ref = Coral::ManagedObjectRef::Create(object);
+		object.Destroy();
+
+		auto boolField = InFieldType.GetFieldHandle("BoolFieldTest");
+		auto stringField = InFieldType.GetFieldHandle("StringFieldTest");
+
+		ref.SetFieldValue(boolField, true);
+		ref.SetFieldValue<std::string>(stringField, "Hello, World!");
+
+		bool result = ref.GetFieldValue<bool>(boolField) && ref.GetFieldValue<std::string>(stringField) == "Hello, World!";
+		ref.Release();
+		return result;
+	});
+}
+
+static void RegisterIdentityMapTests(Coral::HostInstance& InHost, Coral::Type& InType)
+{
+	RegisterTest("ObjectIdentityTest", [&InHost, &InType]() mutable
+	{
+		InHost.SetObjectIdentityEnabled(true);
+
+		auto object = InType.CreateInstance();
+		auto copy = object;
+		Coral::WeakManagedObject weak(object);
+		auto locked = weak.TryLock();
+
+		bool result = copy.m_Handle == object.m_Handle && locked.m_Handle == object.m_Handle;
+
+		// The shared handle stays valid until every copy is destroyed
+		copy.Destroy();
+		locked.Destroy();
+		object.SetFieldValue<int32_t>("Counter", 3);
+		result = result && object.GetFieldValue<int32_t>("Counter") == 3;
+
+		InHost.SetObjectIdentityEnabled(false);
+
+		auto unshared = object;
+		result = result && unshared.m_Handle != object.m_Handle;
+		unshared.Destroy();
+		object.Destroy();
+
+		return result;
+	});
+}
+
+static void RegisterObjectPoolTests(Coral::HostInstance& InHost, Coral::Type& InType)
+{
+	RegisterTest("ObjectPoolTest", [&InType]() mutable
+	{
+		InType.EnablePooling(2);
+
+		auto object = InType.CreateInstance();
+		object.SetFieldValue<int32_t>("Counter", 4);
+		auto handle = object.m_Handle;
+		object.Destroy();
+
+		// The pooled instance is reused with the same handle and has been reset
+		auto reused = InType.CreateInstance();
+		bool result = reused.m_Handle == handle && reused.GetFieldValue<int32_t>("Counter") == 0;
+
+		auto copy = reused;
+		copy.Destroy();
+		reused.Destroy();
+
+		auto stats = InType.GetPoolStats();
+		result = result && stats.Hits == 1 && stats.Misses == 1 && stats.PooledCount == 1;
+
+		InType.DisablePooling();
+		return result && InType.GetPoolStats().PooledCount == 0;
+	});
+	RegisterTest("ObjectPoolSideTableTest", [&InType]() mutable
+	{
+		static int32_t s_FreedCount = 0;
+		s_FreedCount = 0;
+
+		InType.EnablePooling(2);
+
+		auto object = InType.CreateInstance();
+		object.SetUserData(new int32_t(1), [](void* InData)
+		{
+			delete static_cast<int32_t*>(InData);
+			s_FreedCount++;
+		});
+		auto ref = Coral::ManagedObjectRef::Create(object);
+		object.Destroy();
+
+		// Returning the instance to the pool frees its user data and invalidates refs to it
+		auto reused = InType.CreateInstance();
+		bool result = s_FreedCount == 1 && reused.GetUserData() == nullptr && !ref.IsAlive();
+		reused.Destroy();
+
+		InType.DisablePooling();
+		return result;
+	});
+	RegisterTest("ObjectPoolIdentityTest", [&InHost, &InType]() mutable
+	{
+		InHost.SetObjectIdentityEnabled(true);
+		InType.EnablePooling(2);
+
+		auto object = InType.CreateInstance();
+		auto copy = object;
+		auto handle = object.m_Handle;
+		bool result = copy.m_Handle == handle;
+
+		// The instance only goes back to the pool once every copy of the shared handle is destroyed
+		copy.Destroy();
+		result = result && InType.GetPoolStats().PooledCount == 0;
+		object.Destroy();
+		result = result && InType.GetPoolStats().PooledCount == 1;
+
+		auto reused = InType.CreateInstance();
+		auto reusedCopy = reused;
+		result = result && reused.m_Handle == handle && reusedCopy.m_Handle == handle;
+		reusedCopy.Destroy();
+		reused.Destroy();
+
+		InType.DisablePooling();
+		InHost.SetObjectIdentityEnabled(false);
+		return result;
+	});
+}
+
+static std::atomic<int32_t> s_FreedUserDataCount = 0;
+
+static void RegisterUserDataTests(Coral::Type& InType)
+{
+	RegisterTest("UserDataTest", [&InType]() mutable
+	{
+		static int32_t data = 42;
+
+		auto object = InType.CreateInstance();
+		object.SetUserData(&data);
+
+		auto copy = object;
+		bool result = copy.GetUserData<int32_t>() == &data && *copy.GetUserData<int32_t>() == 42;
+
+		copy.SetUserData(nullptr);
+		result = result && object.GetUserData() == nullptr;
+
+		object.Destroy();
+		copy.Destroy();
+		return result;
+	});
+	RegisterTest("UserDataDeleterTest", [&InType]() mutable
+	{
+		s_FreedUserDataCount = 0;
+
+		auto object = InType.CreateInstance();
+		object.SetUserData(new int32_t(1), [](void* InData)
+		{
+			delete static_cast<int32_t*>(InData);
+			s_FreedUserDataCount++;
+		});
+
+		// Replacing the pointer frees the previous one
+		object.SetUserData(new int32_t(2), [](void* InData)
+		{
+			delete static_cast<int32_t*>(InData);
+			s_FreedUserDataCount++;
+		});
+
+		bool result = s_FreedUserDataCount == 1 && *object.GetUserData<int32_t>() == 2;
+		object.Destroy();
+
+		Coral::GC::Collect();
+		Coral::GC::WaitForPendingFinalizers();
+
+		return result && s_FreedUserDataCount == 2;
+	});
+}
+
+static void RegisterStringInterningTests(Coral::HostInstance& InHost, Coral::ManagedObject& InObject)
+{
+	RegisterTest("StringInterningTest", [&InHost, &InObject]() mutable
+	{
+		auto invoke = [&InObject]()
+		{
+			Coral::ScopedString value = Coral::String::New("InternedString");
+			return InObject.InvokeMethod<Coral::Bool32, Coral::String>("SameStringInstanceTest", value);
+		};
+
+		InHost.SetStringInterningEnabled(true, 16);
+		invoke();
+		bool result = invoke();
+
+		auto stats = InHost.GetStringInterningStats();
+		result = result && stats.Hits >= 1 && stats.Count >= 1 && stats.Count <= 16;
+
+		InHost.SetStringInterningEnabled(false);
+		invoke();
+		return result && !invoke();
+	});
+}
+
+static void RegisterArrayParameterTests(Coral::Type& InType, Coral::ManagedObject& InObject)
+{
+	RegisterTest("ArrayParameterTest", [&InObject]() mutable
+	{
+		auto values = Coral::Array<float>::New({ 1.0f, 2.0f, 3.0f, 4.0f });
+		float result = InObject.InvokeMethod<float, Coral::Array<float>&>("ArraySumTest", values);
+		Coral::Array<float>::Free(values);
+		return result == 10.0f;
+	});
+	RegisterTest("StructArrayParameterTest", [&InObject]() mutable
+	{
+		auto values = Coral::Array<DummyStruct>::New({ { 1, 0.0f, 2 }, { 3, 0.0f, 4 } });
+		int32_t result = InObject.InvokeMethod<int32_t, Coral::Array<DummyStruct>&>("StructArraySumTest", values);
+		Coral::Array<DummyStruct>::Free(values);
+		return result == 10;
+	});
+	RegisterTest("ObjectArrayParameterTest", [&InType, &InObject]() mutable
+	{
+		Coral::ManagedObject objects[3] = { InType.CreateInstance(1), InType.CreateInstance(2), InType.CreateInstance(3) };
+
+		// Only the handles are read, the array doesn't own the objects
+		auto values = Coral::Array<Coral::ManagedObject>::New(3);
+		for (size_t i = 0; i < 3; i++)
+			values[i].m_Handle = objects[i].m_Handle;
+
+		int32_t result = InObject.InvokeMethod<int32_t, Coral::Array<Coral::ManagedObject>&>("ObjectArraySumTest", values);
+		Coral::Array<Coral::ManagedObject>::Free(values);
+		return result == 6;
+	});
+}
+
+static void RegisterArrayViewTests(Coral::ManagedObject& InObject)
+{
+	RegisterTest("ArrayViewFieldTest", [&InObject]() mutable
+	{
+		auto view = InObject.GetFieldValue<Coral::ArrayView<int32_t>>("IntArrayTest");
+		if (view.Length() != 4 || view[0] != 5 || view[3] != 64)
+			return false;
+
+		// Writes go to the managed array
+		view[1] = 20;
+		view.Release();
+
+		auto other = InObject.GetFieldValue<Coral::ArrayView<int32_t>>("IntArrayTest");
+		bool result = view.IsEmpty() && other[1] == 20;
+		other[1] = 2;
+		return result;
+	});
+	RegisterTest("ArrayViewPropertyTest", [&InObject]() mutable
+	{
+		auto view = InObject.GetPropertyValue<Coral::ArrayView<int32_t>>("IntArrayProp");
+		int32_t sum = 0;
+		for (int32_t value : view)
+			sum += value;
+		return sum == 56;
+	});
+}
+
+static void RegisterAllocationFreeTests(Coral::ManagedObject& InMethodObject, Coral::ManagedObject& InFieldObject)
+{
+	// Unmanaged return values and field / property values are written straight into native memory, so warmed up calls must not allocate
+	auto measureAllocations = [](auto&& InFunc)
+	{
+		InFunc();
+
+		int64_t before = Coral::GC::GetAllocatedBytesForCurrentThread();
+
+		for (int32_t i = 0; i < 1000; i++)
+			InFunc();
+
+		return Coral::GC::GetAllocatedBytesForCurrentThread() - before;
+	};
+
+	RegisterTest("AllocationFreeInvokeTest", [&InMethodObject, measureAllocations]() mutable
+	{
+		auto method = InMethodObject.GetType().GetMethodHandle<int32_t>("IntTest");
+		DummyStruct value = { 10, 10.0f, 10 };
+
+		return measureAllocations([&]()
+		{
+			InMethodObject.InvokeMethod<int32_t, int32_t>(method, 10);
+			InMethodObject.InvokeMethod<int32_t, int32_t>("IntTest", 10);
+			InMethodObject.InvokeMethod<DummyStruct, DummyStruct&>("DummyStructTest", value);
+		}) == 0;
+	});
+	RegisterTest("AllocationFreeMemberTest", [&InFieldObject, measureAllocations]() mutable
+	{
+		const auto& type = InFieldObject.GetType();
+		auto field = type.GetFieldHandle("IntFieldTest");
+		auto property = type.GetPropertyHandle("IntPropertyTest");
+
+		return measureAllocations([&]()
+		{
+			InFieldObject.GetFieldValue<int32_t>(field);
+			InFieldObject.GetFieldValue<double>("DoubleFieldTest");
+			InFieldObject.GetPropertyValue<int32_t>(property);
+			InFieldObject.GetPropertyValue<float>("FloatPropertyTest");
+		}) == 0;
+	});
+}
+
+static void RegisterTypeCacheTests(Coral::Type& InType)
+{
+	RegisterTest("TypeCacheDeduplicationTest", [&InType]() mutable
+	{
+		Coral::Type* intType = nullptr;
+		int32_t intMethodCount = 0;
+
+		for (auto& method : InType.GetMethods())
+		{
+			if (Coral::ScopedString(method.GetReturnType().GetFullName()) != "System.Int32")
+				continue;
+
+			// Every method returning an int has to resolve to the same cached type
+			if (intType != nullptr && &method.GetReturnType() != intType)
+				return false;
+
+			intType = &method.GetReturnType();
+			intMethodCount++;
+		}
+
+		return intMethodCount > 1;
+	});
+}
+
+static void RegisterMemberNameTests(Coral::ManagedObject& InObject)
+{
+	static_assert(CORAL_NAME("IntTest").GetHash() == Coral::MemberName::Hash("IntTest"));
+
+	RegisterTest("MemberNameMethodTest", [&InObject]() mutable
+	{
+		constexpr Coral::MemberName intTest("IntTest");
+		return InObject.InvokeMethod<int32_t, int32_t>(intTest, 10) == 20 && InObject.InvokeMethod<int32_t, int32_t>(CORAL_NAME("IntTest"), 25) == 50;
+	});
+	RegisterTest("MemberNameFieldTest", [&InObject]() mutable
+	{
+		InObject.SetFieldValue<int32_t>(CORAL_NAME("Counter"), 15);
+		std::string fieldName = "Counter";
+		return InObject.GetFieldValue<int32_t>(fieldName) == 15;
+	});
+}
+
+static void RegisterThreadingTests(Coral::Type& InType)
+{
+	RegisterTest("MultiThreadedInvokeTest", [&InType]() mutable
+	{
+		constexpr int32_t threadCount = 8;
+		constexpr int32_t iterations = 1000;
+
+		std::atomic<int32_t> failures = 0;
+		std::atomic<int32_t> ready = 0;
+		std::vector<std::thread> threads;
+
+		for (int32_t t = 0; t < threadCount; t++)
+		{
+			threads.emplace_back([&InType, &failures, &ready, t]()
+			{
+				auto object = InType.CreateInstance();
+
+				ready++;
+				while (ready < threadCount)
+					std::this_thread::yield();
+
+				// No earlier test calls these methods and each thread starts on a different one,
+				// so several threads resolve and cache the same methods at the same time
+				for (int32_t i = 0; i < iterations; i++)
+				{
+					bool succeeded = true;
+
+					switch ((t + i) % 4)
+					{
+					case 0: succeeded = object.InvokeMethod<int32_t, int32_t&>("ThreadedIntTest", i) == i * 2; break;
+					case 1: succeeded = object.InvokeMethod<int64_t, int64_t>("ThreadedLongTest", 21) == 42; break;
+					case 2: succeeded = object.InvokeMethod<double, double>("ThreadedDoubleTest", 2.0) == 4.0; break;
+					case 3: succeeded = object.InvokeMethod<int16_t, int16_t>("ThreadedShortTest", 8) == 16; break;
+					}
+
+					if (!succeeded)
+						failures++;
+				}
+
+				object.Destroy();
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		return failures == 0;
+	});
+}
+
+static void RegisterFunctionPointerTests(Coral::Type& InType)
+{
+	RegisterTest("UnmanagedFunctionPointerTest", [&InType]() mutable
+	{
+		auto func = InType.GetFunctionPointer<int32_t(int32_t, int32_t)>("UnmanagedAddTest");
+		return func != nullptr && func(10, 20) == 30;
+	});
+	RegisterTest("ThunkFunctionPointerTest", [&InType]() mutable
+	{
+		auto func = InType.GetFunctionPointer<float(float, float)>("ThunkMultiplyTest");
+		return func != nullptr && std::abs(func(2.5f, 4.0f) - 10.0f) < 0.001f;
+	});
+	RegisterTest("StructThunkFunctionPointerTest", [&InType]() mutable
+	{
+		auto func = InType.GetFunctionPointer<DummyStruct(DummyStruct, bool)>("ThunkStructTest");
+		if (func == nullptr)
+			return false;
+
+		DummyStruct value = { 10, 10.0f, 10 };
+		auto result = func(value, true);
+		auto unchanged = func(value, false);
+		return result.X == 20 && std::abs(result.Y - 20.0f) < 0.001f && result.Z == 20 && unchanged.X == 10;
+	});
+	RegisterTest("FunctionPointerSignatureMismatchTest", [&InType]() mutable
+	{
+		return InType.GetFunctionPointer<int32_t(float, int32_t)>("UnmanagedAddTest") == nullptr;
+	});
+}
+
 static void RegisterFieldMarshalTests(Coral::ManagedObject& InObject)
 {
 	RegisterTest("SByteFieldTest", [&InObject]() mutable
@@ -430,6 +1165,136 @@ static void RegisterFieldMarshalTests(Coral::ManagedObject& InObject)
 	});
 }
 
+static void RegisterMemberHandleTests(Coral::ManagedObject& InObject)
+{
+	const auto& type = InObject.GetType();
+
+	RegisterTest("IntFieldHandleTest", [&InObject, &type]() mutable
+	{
+		auto field = type.GetFieldHandle("IntFieldTest");
+		if (!field.IsValid())
+			return false;
+		InObject.SetFieldValue<int32_t>(field, 30);
+		return InObject.GetFieldValue<int32_t>(field) == 30 && InObject.GetFieldValue<int32_t>("IntFieldTest") == 30;
+	});
+	RegisterTest("BoolFieldHandleTest", [&InObject, &type]() mutable
+	{
+		auto field = type.GetFieldHandle("BoolFieldTest");
+		InObject.SetFieldValue(field, true);
+		if (!InObject.GetFieldValue<bool>(field))
+			return false;
+		InObject.SetFieldValue(field, false);
+		return !InObject.GetFieldValue<bool>(field);
+	});
+	RegisterTest("StringFieldHandleTest", [&InObject, &type]() mutable
+	{
+		auto field = type.GetFieldHandle("StringFieldTest");
+		InObject.SetFieldValue<std::string>(field, "Hello, Handle!");
+		return InObject.GetFieldValue<std::string>(field) == "Hello, Handle!";
+	});
+	RegisterTest("FieldInfoHandleTest", [&InObject, &type]() mutable
+	{
+		for (auto fieldInfo : type.GetFields())
+		{
+			if (Coral::ScopedString(fieldInfo.GetName()) != "DoubleFieldTest")
+				continue;
+
+			auto field = fieldInfo.GetHandle();
+			InObject.SetFieldValue<double>(field, 30.0);
+			return std::abs(InObject.GetFieldValue<double>(field) - 30.0) < 0.001;
+		}
+
+		return false;
+	});
+	RegisterTest("IntPropertyHandleTest", [&InObject, &type]() mutable
+	{
+		auto property = type.GetPropertyHandle("IntPropertyTest");
+		if (!property.IsValid())
+			return false;
+		InObject.SetPropertyValue<int32_t>(property, 30);
+		return InObject.GetPropertyValue<int32_t>(property) == 30;
+	});
+	RegisterTest("BoolPropertyHandleTest", [&InObject, &type]() mutable
+	{
+		auto property = type.GetPropertyHandle("BoolPropertyTest");
+		InObject.SetPropertyValue(property, false);
+		return !InObject.GetPropertyValue<bool>(property);
+	});
+	RegisterTest("StringPropertyHandleTest", [&InObject, &type]() mutable
+	{
+		auto property = type.GetPropertyHandle("StringPropertyTest");
+		InObject.SetPropertyValue<std::string>(property, "Hello, Handle!");
+		return InObject.GetPropertyValue<std::string>(property) == "Hello, Handle!";
+	});
+}
+
+struct FieldSnapshot
+{
+	int32_t Int;
+	float Float;
+	double Double;
+	Coral::Bool32 Bool;
+	Coral::String String;
+};
+
+static void RegisterFieldSetTests(Coral::ManagedObject& InObject)
+{
+	const auto& type = InObject.GetType();
+
+	RegisterTest("FieldSetTest", [&InObject, &type]() mutable
+	{
+		auto fieldSet = type.CreateFieldSet<FieldSnapshot>({
+			{ type.GetFieldHandle("IntFieldTest"), offsetof(FieldSnapshot, Int) },
+			{ type.GetFieldHandle("FloatFieldTest"), offsetof(FieldSnapshot, Float) },
+			{ type.GetFieldHandle("DoubleFieldTest"), offsetof(FieldSnapshot, Double) },
+			{ type.GetFieldHandle("BoolFieldTest"), offsetof(FieldSnapshot, Bool) },
+			{ type.GetFieldHandle("StringFieldTest"), offsetof(FieldSnapshot, String) },
+		});
+
+		if (!fieldSet.IsValid())
+			return false;
+
+		FieldSnapshot input = { 50, 5.0f, 15.0, true, Coral::String::New("Hello, FieldSet!") };
+		InObject.WriteFields(fieldSet, &input);
+		Coral::String::Free(input.String);
+
+		if (InObject.GetFieldValue<int32_t>("IntFieldTest") != 50 || !InObject.GetFieldValue<bool>("BoolFieldTest"))
+			return false;
+
+		FieldSnapshot output = {};
+		InObject.ReadFields(fieldSet, &output);
+		std::string str = output.String;
+		Coral::String::Free(output.String);
+
+		return output.Int == 50 && output.Float == 5.0f && output.Double == 15.0 && output.Bool && str == "Hello, FieldSet!";
+	});
+	RegisterTest("FieldSetPointerTest", [&InObject, &type]() mutable
+	{
+		auto fieldSet = type.CreateFieldSet({ { type.GetFieldHandle("IntPtrFieldTest"), 0 } }, sizeof(void*));
+
+		if (!fieldSet.IsValid())
+			return false;
+
+		int32_t value = 0;
+		void* input = &value;
+		InObject.WriteFields(fieldSet, &input);
+
+		// Reading the fields and writing them back has to leave the pointer unchanged
+		void* output = nullptr;
+		InObject.ReadFields(fieldSet, &output);
+		InObject.WriteFields(fieldSet, &output);
+		output = nullptr;
+		InObject.ReadFields(fieldSet, &output);
+
+		return output == &value;
+	});
+	RegisterTest("FieldSetOutOfBoundsTest", [&type]() mutable
+	{
+		auto fieldSet = type.CreateFieldSet({ { type.GetFieldHandle("DoubleFieldTest"), 4 } }, sizeof(double));
+		return !fieldSet.IsValid();
+	});
+}
+
 static void RunTests()
 {
 	size_t passedTests = 0;
@@ -450,6 +1315,99 @@ static void RunTests()
 	std::cout << "[NativeTest]: Done. " << passedTests << " passed, " << tests.size() - passedTests  << " failed.\n";
 }
 
+static void RunInvokeBenchmark(Coral::HostInstance& InHost, Coral::ManagedObject& InObject)
+{
+	constexpr int32_t iterations = 100000;
+
+	auto measure = [&InObject]()
+	{
+		DummyStruct value = { 10, 10.0f, 10 };
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (int32_t i = 0; i < iterations; i++)
+		{
+			InObject.InvokeMethod<int32_t, int32_t&>("IntTest", i);
+			InObject.InvokeMethod<DummyStruct, DummyStruct&>("DummyStructTest", value);
+		}
+
+		auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::micro>(end - start).count() / (iterations * 2);
+	};
+
+	InHost.SetCompiledInvokersEnabled(false);
+	double reflectionTime = measure();
+
+	InHost.SetCompiledInvokersEnabled(true);
+	double compiledTime = measure();
+
+	std::cout << "[InvokeBenchmark]: Reflection: " << reflectionTime << "us per call, Compiled: " << compiledTime << "us per call (" << reflectionTime / compiledTime << "x)\n";
+}
+
+static void RunArrayMarshalBenchmark(Coral::ManagedObject& InObject)
+{
+	auto method = InObject.GetType().GetMethodHandle<Coral::Array<float>>("ArraySumTest");
+
+	for (size_t elementCount = 16; elementCount <= 1024 * 1024; elementCount *= 4)
+	{
+		std::vector<float> elements(elementCount, 1.0f);
+		auto values = Coral::Array<float>::New(elements);
+
+		const int32_t iterations = static_cast<int32_t>(std::max<size_t>(4 * 1024 * 1024 / elementCount, 8));
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		for (int32_t i = 0; i < iterations; i++)
+			InObject.InvokeMethod<float>(method, values);
+
+		auto end = std::chrono::high_resolution_clock::now();
+		double microseconds = std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+
+		std::cout << "[ArrayMarshalBenchmark]: " << elementCount << " elements: " << microseconds << "us per call (" << (elementCount / microseconds) << " elements/us)\n";
+
+		Coral::Array<float>::Free(values);
+	}
+}
+
+static void RunThreadedInvokeBenchmark(Coral::Type& InType)
+{
+	constexpr int32_t iterations = 100000;
+	const uint32_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	double singleThreadRate = 0.0;
+
+	for (uint32_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+	{
+		std::vector<Coral::ManagedObject> objects;
+		for (uint32_t i = 0; i < threadCount; i++)
+			objects.push_back(InType.CreateInstance());
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		std::vector<std::thread> threads;
+		for (uint32_t t = 0; t < threadCount; t++)
+		{
+			threads.emplace_back([&object = objects[t]]()
+			{
+				for (int32_t i = 0; i < iterations; i++)
+					object.InvokeMethod<int32_t, int32_t&>("IntTest", i);
+			});
+		}
+
+		for (auto& thread : threads)
+			thread.join();
+
+		auto end = std::chrono::high_resolution_clock::now();
+		double seconds = std::chrono::duration<double>(end - start).count();
+		double rate = (static_cast<double>(iterations) * threadCount) / seconds;
+
+		if (threadCount == 1)
+			singleThreadRate = rate;
+
+		std::cout << "[ThreadedInvokeBenchmark]: " << threadCount << " threads: " << rate / 1000000.0 << "M calls/s (" << rate / singleThreadRate << "x)\n";
+	}
+}
+
 int main([[maybe_unused]] int argc, char** argv)
 {
 	auto exeDir = std::filesystem::path(argv[0]).parent_path();
@@ -552,9 +1510,34 @@ int main([[maybe_unused]] int argc, char** argv)
 	auto memberMethodTest = memberMethodTestType.CreateInstance();
 
 	RegisterFieldMarshalTests(fieldTestObject);
+	RegisterArrayViewTests(fieldTestObject);
+	RegisterMemberHandleTests(fieldTestObject);
+	RegisterFieldSetTests(fieldTestObject);
 	RegisterMemberMethodTests(memberMethodTest);
+	RegisterMethodHandleTests(memberMethodTest);
+	RegisterMemberNameTests(memberMethodTest);
+	RegisterFunctionPointerTests(memberMethodTestType);
+	RegisterThreadingTests(memberMethodTestType);
+	RegisterInvokeBatchTests(memberMethodTestType);
+	RegisterConstructorHandleTests(memberMethodTestType);
+	RegisterCreateInstancesTests(memberMethodTestType, assembly.GetLocalType("Testing.Managed.PooledObjectTest"));
+	RegisterSharedObjectTests(memberMethodTestType);
+	RegisterDestroyQueueTests(memberMethodTestType);
+	RegisterWeakObjectTests(memberMethodTestType);
+	RegisterObjectRefTests(memberMethodTestType, fieldTestType);
+	RegisterIdentityMapTests(hostInstance, memberMethodTestType);
+	RegisterUserDataTests(memberMethodTestType);
+	RegisterStringInterningTests(hostInstance, memberMethodTest);
+	RegisterArrayParameterTests(memberMethodTestType, memberMethodTest);
+	RegisterObjectPoolTests(hostInstance, assembly.GetLocalType("Testing.Managed.PooledObjectTest"));
+	RegisterTypeCacheTests(memberMethodTestType);
+	RegisterAllocationFreeTests(memberMethodTest, fieldTestObject);
 	RunTests();
 
+	RunInvokeBenchmark(hostInstance, memberMethodTest);
+	RunThreadedInvokeBenchmark(memberMethodTestType);
+	RunArrayMarshalBenchmark(memberMethodTest);
+
 	memberMethodTest.Destroy();
 	fieldTestObject.Destroy();
 